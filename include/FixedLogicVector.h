@@ -0,0 +1,535 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file FixedLogicVector.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A std_logic_vector of a width known at compile time
+ * @version 0.1
+ *
+ * Many datapaths of a hardware design have a width which is already known
+ * when writing the model (e.g., the 128-bit state of the AES). For those, this
+ * file provides the FixedLogicVector class template, which offers the same
+ * operations as the StdLogicVector class but keeps its value in a fixed array
+ * of 64-bit words. Most of the operations are @c constexpr, such that
+ * constants can be folded at compile time.
+ */
+
+#ifndef FIXEDLOGICVECTOR_H_
+#define FIXEDLOGICVECTOR_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+
+using namespace std;
+
+/**
+ * @class FixedLogicVector
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A std_logic_vector of @p N bits, with @p N known at compile time
+ * @version 0.1
+ *
+ * In contrast to the StdLogicVector, the length of a FixedLogicVector is part
+ * of its type. Thus, all operations work on a fixed number of 64-bit words
+ * without any width checks, GMP calls or dynamic storage. Since the width can
+ * never change, all operations wrap around at @p N bits (e.g., bits shifted
+ * beyond the most significant bit are lost, and sums, differences and
+ * products are computed modulo 2^N).
+ *
+ * @tparam N The length of the vector in bits.
+ */
+template <int N>
+class FixedLogicVector {
+
+	static_assert(N > 0, "A FixedLogicVector must be at least one bit wide.");
+
+public:
+  // **************************************************************************
+  // Constants
+  // **************************************************************************
+  static constexpr int kWords = (N + 63) / 64;
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  array<uint64_t, kWords> words_;
+
+  // **************************************************************************
+  // Utility functions
+  // **************************************************************************
+  /**
+   * @brief Clears the unused bits of the most significant word.
+   */
+  constexpr void Normalize() {
+    if ( N % 64 != 0 ) {
+      words_[kWords - 1] &= (static_cast<uint64_t>(1) << (N % 64)) - 1;
+    }
+  }
+
+  /**
+   * @brief Reverses the bit order of a single 64-bit word.
+   */
+  static constexpr uint64_t ReverseWord(uint64_t _word) {
+    _word = ((_word >> 1) & 0x5555555555555555ULL) |
+        ((_word & 0x5555555555555555ULL) << 1);
+    _word = ((_word >> 2) & 0x3333333333333333ULL) |
+        ((_word & 0x3333333333333333ULL) << 2);
+    _word = ((_word >> 4) & 0x0F0F0F0F0F0F0F0FULL) |
+        ((_word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    _word = ((_word >> 8) & 0x00FF00FF00FF00FFULL) |
+        ((_word & 0x00FF00FF00FF00FFULL) << 8);
+    _word = ((_word >> 16) & 0x0000FFFF0000FFFFULL) |
+        ((_word & 0x0000FFFF0000FFFFULL) << 16);
+    return (_word >> 32) | (_word << 32);
+  }
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  /**
+   * @brief Creates a FixedLogicVector and initializes its value to zero.
+   */
+  constexpr FixedLogicVector() : words_() {}
+
+  /**
+   * @brief Creates a FixedLogicVector and initializes its value to the
+   *   provided @p _value (truncated to @p N bits).
+   * @param _value The value to be assigned to the FixedLogicVector.
+   */
+  constexpr explicit FixedLogicVector(unsigned long long _value) : words_() {
+    words_[0] = _value;
+    Normalize();
+  }
+
+  /**
+   * @brief Creates a FixedLogicVector from a FixedLogicVector of another
+   *   width, either zero-extending or truncating its value.
+   * @param _other The FixedLogicVector to be converted.
+   */
+  template <int M>
+  constexpr explicit FixedLogicVector(const FixedLogicVector<M> & _other) :
+      words_() {
+    for (int i = 0; i < kWords && i < FixedLogicVector<M>::kWords; ++i) {
+      words_[i] = _other.getWord(i);
+    }
+    Normalize();
+  }
+
+  /**
+   * @brief Creates a FixedLogicVector from a StdLogicVector. Bits of the
+   *   StdLogicVector beyond @p N are truncated.
+   * @param _other The StdLogicVector to be converted.
+   */
+  explicit FixedLogicVector(const StdLogicVector & _other) : words_() {
+    const mpz_t & value = _other.getValue();
+
+    for (int i = 0; i < kWords; ++i) {
+#if GMP_NUMB_BITS == 64
+      words_[i] = mpz_getlimbn(value, i);
+#else
+      words_[i] = static_cast<uint64_t>(mpz_getlimbn(value, 2*i)) |
+          (static_cast<uint64_t>(mpz_getlimbn(value, 2*i + 1)) << 32);
+#endif
+    }
+    Normalize();
+  }
+
+  /**
+   * @brief Creates a FixedLogicVector from a string representation of its
+   *   value in the given number @p _base.
+   * @param _value The value as a string (most significant digit first).
+   * @param _base The base in which the @p _value is given.
+   */
+  FixedLogicVector(string_view _value, int _base) :
+      FixedLogicVector(StdLogicVector(_value, _base, N)) {}
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  /**
+   * @brief Returns the length of the FixedLogicVector.
+   * @return The length of the FixedLogicVector (i.e., @p N).
+   */
+  constexpr int getLength() const {
+    return N;
+  }
+
+  /**
+   * @brief Returns one of the 64-bit words holding the value.
+   * @param _index The index of the word (0 is the least significant one).
+   * @return The word at position @p _index.
+   */
+  constexpr uint64_t getWord(int _index) const {
+    return words_[_index];
+  }
+
+
+  // **************************************************************************
+  // Utility functions
+  // **************************************************************************
+  /**
+   * @brief Converts the value into the least significant 64 bits.
+   * @return The value of the FixedLogicVector as an unsigned long long.
+   */
+  constexpr unsigned long long ToULL() const {
+    return words_[0];
+  }
+
+  /**
+   * @brief Converts the FixedLogicVector into a StdLogicVector of length
+   *   @p N.
+   * @return The StdLogicVector holding the same value.
+   */
+  StdLogicVector ToStdLogicVector() const {
+    StdLogicVector result(static_cast<unsigned int>(N));
+#if GMP_NUMB_BITS == 64
+    mp_limb_t * limbs = result.ModifyLimbs(kWords);
+    for (int i = 0; i < kWords; ++i) {
+      limbs[i] = words_[i];
+    }
+    result.FinishLimbs(kWords);
+#else
+    mp_limb_t * limbs = result.ModifyLimbs(2*kWords);
+    for (int i = 0; i < kWords; ++i) {
+      limbs[2*i]     = static_cast<mp_limb_t>(words_[i]);
+      limbs[2*i + 1] = static_cast<mp_limb_t>(words_[i] >> 32);
+    }
+    result.FinishLimbs(2*kWords);
+#endif
+    return result;
+  }
+
+  /**
+   * @copydoc StdLogicVector::ToString(int, bool) const
+   */
+  string ToString(int _base, bool _pad) const {
+    return ToStdLogicVector().ToString(_base, _pad);
+  }
+
+  /**
+   * @copydoc StdLogicVector::ToString(int) const
+   */
+  string ToString(int _base) const {
+    return ToString(_base, false);
+  }
+
+
+  // **************************************************************************
+  // Operator overloadings
+  // **************************************************************************
+  constexpr bool operator==(const FixedLogicVector & _input) const {
+    for (int i = 0; i < kWords; ++i) {
+      if ( words_[i] != _input.words_[i] ) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr bool operator!=(const FixedLogicVector & _input) const {
+    return !(*this == _input);
+  }
+
+  friend ostream & operator<<(ostream & _os, const FixedLogicVector & _vec) {
+    return _os << _vec.ToStdLogicVector();
+  }
+
+
+  // **************************************************************************
+  // Bitwise operations
+  // **************************************************************************
+  /**
+   * @copydoc StdLogicVector::TestBit(int) const
+   */
+  constexpr int TestBit(int _index) const {
+    if ( _index < 0 || _index >= N ) {
+      return 0;
+    }
+    return static_cast<int>((words_[_index / 64] >> (_index % 64)) & 1);
+  }
+
+  /**
+   * @brief Shift left operation. Bits shifted beyond bit @p N - 1 are lost.
+   * @param _bits Number of bits to be shifted to the left.
+   * @return The FixedLogicVector shifted to the left.
+   */
+  constexpr FixedLogicVector & ShiftLeft(int _bits) {
+    int wordShift = _bits / 64;
+    int bitShift  = _bits % 64;
+
+    if ( _bits <= 0 ) {
+      return *this;
+    }
+    for (int i = kWords - 1; i >= 0; --i) {
+      uint64_t word = 0;
+      if ( i - wordShift >= 0 ) {
+        word = words_[i - wordShift] << bitShift;
+        if ( bitShift != 0 && i - wordShift - 1 >= 0 ) {
+          word |= words_[i - wordShift - 1] >> (64 - bitShift);
+        }
+      }
+      words_[i] = word;
+    }
+    Normalize();
+    return *this;
+  }
+
+  /**
+   * @brief Shift right operation.
+   * @param _bits Number of bits to be shifted to the right.
+   * @return The FixedLogicVector shifted to the right.
+   */
+  constexpr FixedLogicVector & ShiftRight(int _bits) {
+    int wordShift = _bits / 64;
+    int bitShift  = _bits % 64;
+
+    if ( _bits <= 0 ) {
+      return *this;
+    }
+    for (int i = 0; i < kWords; ++i) {
+      uint64_t word = 0;
+      if ( i + wordShift < kWords ) {
+        word = words_[i + wordShift] >> bitShift;
+        if ( bitShift != 0 && i + wordShift + 1 < kWords ) {
+          word |= words_[i + wordShift + 1] << (64 - bitShift);
+        }
+      }
+      words_[i] = word;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Rotate left operation. Bits shifted beyond bit @p N - 1 re-enter
+   *   at bit 0.
+   * @param _bits Number of bits to be rotated to the left. Negative values
+   *   rotate to the right.
+   * @return The rotated FixedLogicVector.
+   */
+  constexpr FixedLogicVector & RotateLeft(int _bits) {
+    int bits = ((_bits % N) + N) % N;
+
+    if ( bits == 0 ) {
+      return *this;
+    }
+    if ( kWords == 1 ) {
+      words_[0] = (words_[0] << bits) | (words_[0] >> (N - bits));
+      Normalize();
+      return *this;
+    }
+    FixedLogicVector wrapped(*this);
+    wrapped.ShiftRight(N - bits);
+    return ShiftLeft(bits).Or(wrapped);
+  }
+
+  /**
+   * @brief Rotate right operation.
+   * @param _bits Number of bits to be rotated to the right. Negative values
+   *   rotate to the left.
+   * @return The rotated FixedLogicVector.
+   */
+  constexpr FixedLogicVector & RotateRight(int _bits) {
+    return RotateLeft(-(_bits % N));
+  }
+
+  /**
+   * @brief Bitwise AND operation.
+   * @param _operand The FixedLogicVector to perform the AND operation with.
+   * @return The result of the bitwise AND operation.
+   */
+  constexpr FixedLogicVector & And(const FixedLogicVector & _operand) {
+    for (int i = 0; i < kWords; ++i) {
+      words_[i] &= _operand.words_[i];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Bitwise OR operation.
+   * @param _operand The FixedLogicVector to perform the OR operation with.
+   * @return The result of the bitwise OR operation.
+   */
+  constexpr FixedLogicVector & Or(const FixedLogicVector & _operand) {
+    for (int i = 0; i < kWords; ++i) {
+      words_[i] |= _operand.words_[i];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Bitwise XOR operation.
+   * @param _operand The FixedLogicVector to perform the XOR operation with.
+   * @return The result of the bitwise XOR operation.
+   */
+  constexpr FixedLogicVector & Xor(const FixedLogicVector & _operand) {
+    for (int i = 0; i < kWords; ++i) {
+      words_[i] ^= _operand.words_[i];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Clears all bits from bit @p _width upwards. Note that, unlike for
+   *   the StdLogicVector, the length of a FixedLogicVector cannot change.
+   * @param _width Number of preserved bits (others will be cleared).
+   * @return The truncated FixedLogicVector.
+   */
+  constexpr FixedLogicVector & TruncateAfter(int _width) {
+    for (int i = 0; i < kWords; ++i) {
+      if ( _width <= 64*i ) {
+        words_[i] = 0;
+      } else if ( _width < 64*(i + 1) ) {
+        words_[i] &= (static_cast<uint64_t>(1) << (_width - 64*i)) - 1;
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Replaces a number of bits within the current FixedLogicVector with
+   *   another FixedLogicVector.
+   * @param _begin The 0-based index of the first bit to be replaced.
+   * @param _input The FixedLogicVector used as a replacement. Bits exceeding
+   *   the length of @c this are ignored.
+   * @return The FixedLogicVector with the replaced bits.
+   */
+  template <int M>
+  constexpr FixedLogicVector & ReplaceBits(int _begin,
+      const FixedLogicVector<M> & _input) {
+    FixedLogicVector mask;
+    FixedLogicVector bits(_input);
+
+    if ( _begin < 0 ) {
+      _begin = 0;
+    }
+    for (int i = 0; i < kWords; ++i) {
+      mask.words_[i] = ~static_cast<uint64_t>(0);
+    }
+    mask.TruncateAfter(M).ShiftLeft(_begin);
+    bits.TruncateAfter(M).ShiftLeft(_begin);
+    for (int i = 0; i < kWords; ++i) {
+      words_[i] = (words_[i] & ~mask.words_[i]) | bits.words_[i];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Reverses the bit order of the FixedLogicVector.
+   * @return The FixedLogicVector with its value in reversed bit order.
+   */
+  constexpr FixedLogicVector & ReverseBitOrder() {
+    for (int i = 0; i < kWords / 2; ++i) {
+      uint64_t tmp = words_[i];
+      words_[i] = ReverseWord(words_[kWords - 1 - i]);
+      words_[kWords - 1 - i] = ReverseWord(tmp);
+    }
+    if ( kWords % 2 != 0 ) {
+      words_[kWords / 2] = ReverseWord(words_[kWords / 2]);
+    }
+    return ShiftRight(64*kWords - N);
+  }
+
+
+  // **************************************************************************
+  // Arithmetic operations
+  // **************************************************************************
+  /**
+   * @brief Addition of another FixedLogicVector modulo 2^N.
+   * @param _operand The FixedLogicVector to perform the addition with.
+   * @return The sum of the two FixedLogicVectors.
+   */
+  constexpr FixedLogicVector & Add(const FixedLogicVector & _operand) {
+    uint64_t carry = 0;
+
+    for (int i = 0; i < kWords; ++i) {
+      uint64_t sum = words_[i] + _operand.words_[i];
+      uint64_t carryOut = (sum < words_[i]) ? 1 : 0;
+      words_[i] = sum + carry;
+      carry = carryOut | ((words_[i] < sum) ? 1 : 0);
+    }
+    Normalize();
+    return *this;
+  }
+
+  /**
+   * @brief Subtraction of another FixedLogicVector modulo 2^N.
+   * @param _operand The FixedLogicVector to be subtracted.
+   * @return The difference of the two FixedLogicVectors.
+   */
+  constexpr FixedLogicVector & Sub(const FixedLogicVector & _operand) {
+    uint64_t borrow = 0;
+
+    for (int i = 0; i < kWords; ++i) {
+      uint64_t diff = words_[i] - _operand.words_[i];
+      uint64_t borrowOut = (words_[i] < _operand.words_[i]) ? 1 : 0;
+      words_[i] = diff - borrow;
+      borrow = borrowOut | ((diff < borrow) ? 1 : 0);
+    }
+    Normalize();
+    return *this;
+  }
+
+  /**
+   * @brief Replaces the value by its two's complement modulo 2^N.
+   * @return The negated FixedLogicVector.
+   */
+  constexpr FixedLogicVector & Negate() {
+    FixedLogicVector zero;
+    *this = zero.Sub(*this);
+    return *this;
+  }
+
+  /**
+   * @brief Multiplication with another FixedLogicVector modulo 2^N. Only the
+   *   words below the width of the product are computed.
+   * @param _operand The FixedLogicVector to perform the multiplication with.
+   * @return The truncated product of the two FixedLogicVectors.
+   */
+  constexpr FixedLogicVector & Mul(const FixedLogicVector & _operand) {
+    array<uint64_t, kWords> product = {};
+
+    for (int i = 0; i < kWords; ++i) {
+      uint64_t carry = 0;
+      for (int j = 0; j < kWords - i; ++j) {
+        unsigned __int128 t = static_cast<unsigned __int128>(words_[i]) *
+            _operand.words_[j] + product[i + j] + carry;
+        product[i + j] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+      }
+    }
+    words_ = product;
+    Normalize();
+    return *this;
+  }
+
+  template <int M> friend class FixedLogicVector;
+};
+
+#endif /* FIXEDLOGICVECTOR_H_ */
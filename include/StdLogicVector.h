@@ -37,12 +37,23 @@
 #ifndef STDLOGICVECTOR_H_
 #define STDLOGICVECTOR_H_
 
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
 #include <gmp.h>
 #include <gmpxx.h>
 
 using namespace std;
 
+class StdLogicVectorConstView;
+class StdLogicVectorView;
+class StdLogicVectorConcat;
+template <typename Expression> class StdLogicVectorExpression;
+
 /**
  * @class StdLogicVector
  * @author Michael Muehlberghuber (mbgh,michmueh)
@@ -57,6 +68,13 @@ using namespace std;
  * around the GMP library, which allows simple arithmetic as it is often used
  * when designing with VHDL or other hardware description languages.
  *
+ * Member functions not modifying a StdLogicVector (i.e., all const ones, as
+ * well as the non-const overloads of ToString() and ToULL()) only read its
+ * value. Any number of threads may therefore call them on the same
+ * StdLogicVector concurrently, as long as no thread modifies it at the same
+ * time. Distinct StdLogicVectors may be used by different threads without
+ * any synchronization (see also StdLogicVectorThreadPool).
+ *
  * @see [1] https://gmplib.org/
  */
 class StdLogicVector {
@@ -65,15 +83,66 @@ private:
 	// **************************************************************************
 	// Members
 	// **************************************************************************
+  // Number of limbs kept inline within the object. Values fitting into these
+  // limbs (i.e., up to 256 bits) never touch the heap.
+  static const int kInlineLimbs = 256 / GMP_NUMB_BITS;
+
   mpz_t value_;
+  mp_limb_t inline_[kInlineLimbs];
   int length_;
   bool isDontCare_;
+  bool isWrapping_;
 
   // **************************************************************************
-  // Utility functions
+  // Storage functions
   // **************************************************************************
-  string Zeros(int _length);
-  string Ones(int _length);
+  void InitInline();
+  bool IsInline() const;
+  mp_limb_t * ModifyLimbs(mp_size_t _limbs);
+  mp_limb_t * GrowLimbs(mp_size_t _limbs);
+  void FinishLimbs(mp_size_t _limbs);
+  void SetValue(mpz_srcptr _value);
+  from_chars_result SetDigits(const char * _first, const char * _last,
+      int _base);
+  void MaskToWidth(int _width);
+  const mp_limb_t * ReadLimbsWithinLength(mp_size_t & _size,
+      vector<mp_limb_t> & _scratch) const;
+
+  static mp_size_t LimbsForWidth(int _width);
+
+  static mp_limb_t ReadLimb(const mp_limb_t * _limbs, mp_size_t _size,
+      mp_bitcnt_t _bit);
+  static void DepositBits(mp_limb_t * _dst, mp_bitcnt_t _dstBit,
+      const mp_limb_t * _src, mp_size_t _srcSize, mp_bitcnt_t _srcBit,
+      mp_bitcnt_t _width);
+
+public:
+  // Order of the bytes (or words) when exporting/importing binary data.
+  enum Endian { kBigEndian, kLittleEndian };
+
+  // Interpretation of the value by the arithmetic operations (i.e., as the
+  // numeric_std types unsigned and signed).
+  enum Signedness { kUnsigned, kSigned };
+
+private:
+  template <typename Word>
+  void ImportWords(const Word * _words, size_t _count, Endian _endian);
+  template <typename Word>
+  bool ExportWords(Word * _words, size_t _count, Endian _endian) const;
+  void ExtendLimbs(mp_limb_t * _dst, mp_size_t _size, Signedness _signedness)
+      const;
+  bool IsExtended(mp_size_t _size, Signedness _signedness) const;
+  const mp_limb_t * ReadExtendedLimbs(mp_size_t _size, Signedness _signedness,
+      mp_limb_t * _scratch) const;
+
+  template <int N> friend class FixedLogicVector;
+  friend class StdLogicVectorConstView;
+  friend class StdLogicVectorView;
+  friend class StdLogicVectorArray;
+  friend class StdLogicVectorBitslice;
+  friend class StdLogicVectorConcat;
+  friend class StdLogicVectorModContext;
+  friend class StdULogicVector;
 
 public:
   // **************************************************************************
@@ -84,13 +153,28 @@ public:
   StdLogicVector();
   StdLogicVector(unsigned int _length);
   StdLogicVector(unsigned long long _value, unsigned int _length);
-  StdLogicVector(string _value, int _base, unsigned int _length);
-  StdLogicVector(string _value, int _base, unsigned int _length, bool _isDontCare);
+  StdLogicVector(string_view _value, int _base, unsigned int _length);
+  StdLogicVector(string_view _value, int _base, unsigned int _length,
+      bool _isDontCare);
   StdLogicVector(unsigned char *_value, int _size, unsigned int _length);
 
   // Copy-constructor
   StdLogicVector (const StdLogicVector & _other);
 
+  // Copy-assignment
+  StdLogicVector & operator=(const StdLogicVector & _other);
+
+  // Move-constructor and move-assignment
+  StdLogicVector (StdLogicVector && _other) noexcept;
+  StdLogicVector & operator=(StdLogicVector && _other) noexcept;
+
+  // Evaluation of an expression (see StdLogicVectorExpression.h)
+  template <typename Expression>
+  StdLogicVector(const StdLogicVectorExpression<Expression> & _expression);
+  template <typename Expression>
+  StdLogicVector & operator=(
+      const StdLogicVectorExpression<Expression> & _expression);
+
   // Destructor
   virtual ~StdLogicVector();
 
@@ -102,6 +186,8 @@ public:
   const mpz_t & getValue() const;
   int getLength() const;
   bool isDontCare() const;
+  bool isWrapping() const;
+  void setWrapping(bool _isWrapping);
 
 
   // **************************************************************************
@@ -117,13 +203,33 @@ public:
   string ToString(int _base, bool _pad);
   string ToString(int _base, bool _pad) const;
 
+  size_t FormatLength(int _base, bool _pad) const;
+  size_t FormatTo(char * _buf, size_t _cap, int _base, bool _pad) const;
+  to_chars_result ToChars(char * _first, char * _last, int _base, bool _pad)
+      const;
+
   void ToByteArray(unsigned char _byteArray[]) const;
 
+  bool ToBytes(uint8_t * _bytes, size_t _size, Endian _endian) const;
+  bool ToWords(uint32_t * _words, size_t _count, Endian _endian) const;
+  bool ToWords(uint64_t * _words, size_t _count, Endian _endian) const;
+
+  static from_chars_result FromChars(const char * _first, const char * _last,
+      int _base, unsigned int _length, StdLogicVector & _result);
+  static StdLogicVector FromBytes(const uint8_t * _bytes, size_t _size,
+      Endian _endian, unsigned int _length);
+  static StdLogicVector FromWords(const uint32_t * _words, size_t _count,
+      Endian _endian, unsigned int _length);
+  static StdLogicVector FromWords(const uint64_t * _words, size_t _count,
+      Endian _endian, unsigned int _length);
+
   // **************************************************************************
   // Operator overloadings
   // **************************************************************************
   bool operator==(const StdLogicVector & _input) const;
   bool operator!=(const StdLogicVector & _input) const;
+  bool MatchesWithMask(const StdLogicVector & _expected,
+      const StdLogicVector & _care) const;
   friend ostream & operator<<(ostream & _os, const StdLogicVector & _stdLogicVec);
 
 
@@ -131,24 +237,235 @@ public:
   // Bitwise operations
   // **************************************************************************
   int TestBit(int _index) const;
+  int PopCount() const;
+  int Parity() const;
+  int CountLeadingZeros() const;
+  int CountTrailingZeros() const;
+  int FindFirstSet() const;
+  int HammingDistance(const StdLogicVector & _operand) const;
 
   StdLogicVector & ShiftLeft(int _bits);
   StdLogicVector & ShiftRight(int _bits);
+  StdLogicVector & RotateLeft(int _bits);
+  StdLogicVector & RotateRight(int _bits);
   StdLogicVector & And(const StdLogicVector & _operand);
   StdLogicVector & Or(const StdLogicVector & _operand);
   StdLogicVector & Xor(const StdLogicVector & _operand);
+  StdLogicVector & And(const StdLogicVectorConstView & _operand);
+  StdLogicVector & Or(const StdLogicVectorConstView & _operand);
+  StdLogicVector & Xor(const StdLogicVectorConstView & _operand);
 
   StdLogicVector & TruncateAfter(int _width);
   StdLogicVector & ReplaceBits(int _begin, const StdLogicVector & _input);
+  StdLogicVector Extract(int _hi, int _lo) const;
+  StdLogicVectorView Slice(int _hi, int _lo);
+  StdLogicVectorConstView Slice(int _hi, int _lo) const;
   StdLogicVector & PadRightZeros(int _width);
   StdLogicVector & ReverseBitOrder();
 
+  static StdLogicVector Concat(const StdLogicVector * const _parts[],
+      int _count);
+
+  /**
+   * @brief Concatenates any number of StdLogicVectors (i.e., the VHDL
+   *   expression @c a @c & @c b @c & @c c). The first operand ends up in the
+   *   most significant bits.
+   * @return A StdLogicVector of the summed length of all operands.
+   */
+  template <typename... Parts>
+  static StdLogicVector Concat(const StdLogicVector & _first,
+      const Parts &... _rest) {
+    const StdLogicVector * parts[] = { &_first, &_rest... };
+    return Concat(parts, 1 + sizeof...(Parts));
+  }
+
 
   // **************************************************************************
   // Arithmetic operations
   // **************************************************************************
   StdLogicVector & Add(const StdLogicVector & _operand);
   StdLogicVector & Add(const StdLogicVector & _operand, bool _truncateCarry);
+  StdLogicVector & Add(const StdLogicVectorConstView & _operand);
+  StdLogicVector & Add(const StdLogicVectorConstView & _operand,
+      bool _truncateCarry);
+
+  StdLogicVector & Sub(const StdLogicVector & _operand);
+  StdLogicVector & Sub(const StdLogicVector & _operand,
+      Signedness _signedness);
+  StdLogicVector & Negate();
+  StdLogicVector & Mul(const StdLogicVector & _operand);
+  StdLogicVector & Mul(const StdLogicVector & _operand, bool _truncate,
+      Signedness _signedness);
+  StdLogicVector & Square();
+  StdLogicVector & Square(bool _truncate, Signedness _signedness);
+
+  int Compare(const StdLogicVector & _operand, Signedness _signedness) const;
+
+
+  // **************************************************************************
+  // Carry-less operations (polynomials over GF(2))
+  // **************************************************************************
+  StdLogicVector & ClMul(const StdLogicVector & _operand);
+  StdLogicVector & ClMul(const StdLogicVector & _operand, bool _truncate);
+
+  StdLogicVector & GfMul(const StdLogicVector & _operand,
+      const StdLogicVector & _modulus);
+  StdLogicVector & GfSquare(const StdLogicVector & _modulus);
+  StdLogicVector & GfInv(const StdLogicVector & _modulus);
 };
 
+
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+// Every operation goes through these functions, so they are kept inline and
+// access the fields of the mpz_t directly instead of calling the out-of-line
+// limb functions of GMP. Values are never negative, such that _mp_size is the
+// number of limbs.
+
+/**
+ * @brief Determines whether the value of the StdLogicVector is stored inline
+ *   or in GMP-managed heap storage.
+ * @return True if the value is stored within the inline limbs.
+ */
+inline bool StdLogicVector::IsInline() const {
+  return value_->_mp_d == inline_;
+}
+
+/**
+ * @brief Provides write access to the limbs of the StdLogicVector.
+ *
+ * The value is promoted to GMP-managed storage only if the requested number of
+ * limbs exceeds the inline limbs (see GrowLimbs()). Once promoted, the GMP
+ * storage is kept and reused for all further modifications.
+ *
+ * @param _limbs Number of limbs which have to be writable.
+ * @return Pointer to at least @p _limbs limbs holding the current value. Limbs
+ *   beyond the current size of the value are set to zero.
+ */
+inline mp_limb_t * StdLogicVector::ModifyLimbs(mp_size_t _limbs) {
+  mp_limb_t * limbs = value_->_mp_d;
+
+  if ( _limbs > (IsInline() ? kInlineLimbs : value_->_mp_alloc) ) {
+    return GrowLimbs(_limbs);
+  }
+  for (mp_size_t i = value_->_mp_size; i < _limbs; ++i) {
+    limbs[i] = 0;
+  }
+  return limbs;
+}
+
+/**
+ * @brief Completes a modification of the limbs started with ModifyLimbs().
+ * @param _limbs Number of limbs making up the new value (leading zero limbs
+ *   are stripped automatically).
+ */
+inline void StdLogicVector::FinishLimbs(mp_size_t _limbs) {
+  const mp_limb_t * limbs = value_->_mp_d;
+
+  while ( _limbs > 0 && limbs[_limbs - 1] == 0 ) {
+    _limbs--;
+  }
+  value_->_mp_size = _limbs;
+}
+
+/**
+ * @brief Determines the number of limbs required to hold a value of
+ *   @p _width bits.
+ * @param _width The width of the value in bits (negative widths are treated
+ *   as zero).
+ * @return The number of limbs required.
+ */
+inline mp_size_t StdLogicVector::LimbsForWidth(int _width) {
+  return (((_width > 0) ? _width : 0) + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+}
+
+/**
+ * @brief Determines whether the limbs of the value may be read in place of
+ *   ExtendLimbs(), i.e., the value has no bits above the @a length_ and is
+ *   either extended with zeros or not at all within @p _size limbs. Limbs
+ *   beyond the size of the value are to be read as zeros.
+ */
+inline bool StdLogicVector::IsExtended(mp_size_t _size,
+    Signedness _signedness) const {
+  const mp_limb_t * limbs = value_->_mp_d;
+  mp_size_t size = value_->_mp_size;
+  mp_size_t maxSize = LimbsForWidth(length_);
+  unsigned int rem = length_ % GMP_NUMB_BITS;
+
+  if ( size == 0 ) {
+    return true;
+  }
+  if ( size > maxSize || (size == maxSize && rem != 0 &&
+       (limbs[size - 1] >> rem) != 0) ) {
+    return false;
+  }
+  return _signedness == kUnsigned || length_ >= _size * GMP_NUMB_BITS ||
+      size < maxSize ||
+      ((limbs[size - 1] >> ((length_ - 1) % GMP_NUMB_BITS)) & 1) == 0;
+}
+
+/**
+ * @brief Provides read access to the value extended to @p _size limbs (see
+ *   ExtendLimbs()). The limbs are only copied if they differ from the
+ *   extension or if there are fewer of them.
+ * @param _size Number of limbs to be read.
+ * @param _signedness Determines how the value is extended.
+ * @param _scratch Holds the extended copy of @p _size limbs if required.
+ * @return The limbs of the extended value.
+ */
+inline const mp_limb_t * StdLogicVector::ReadExtendedLimbs(mp_size_t _size,
+    Signedness _signedness, mp_limb_t * _scratch) const {
+  if ( value_->_mp_size == _size && IsExtended(_size, _signedness) ) {
+    return value_->_mp_d;
+  }
+  ExtendLimbs(_scratch, _size, _signedness);
+  return _scratch;
+}
+
+/**
+ * @class StdLogicVectorConcat
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A pending concatenation of StdLogicVectors
+ * @version 0.1
+ *
+ * The VHDL-like concatenation @c a @c & @c b @c & @c c does not create any
+ * intermediate StdLogicVector. Instead, each @c & merely links the operands,
+ * and the result is built with a single allocation once the concatenation is
+ * converted into a StdLogicVector. Since the concatenation refers to its
+ * operands and to the temporary concatenations to its left, it can neither
+ * be copied nor moved, and it can only be extended and converted as an
+ * rvalue. A concatenation stored in a variable (e.g., using @c auto) thus
+ * does not compile when it is used, instead of referring to destroyed
+ * temporaries.
+ */
+class StdLogicVectorConcat {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  const StdLogicVectorConcat * head_;
+  const StdLogicVector * first_;
+  const StdLogicVector * last_;
+  int length_;
+
+public:
+  StdLogicVectorConcat(const StdLogicVector & _first,
+      const StdLogicVector & _last);
+  StdLogicVectorConcat(StdLogicVectorConcat && _head,
+      const StdLogicVector & _last);
+  StdLogicVectorConcat(const StdLogicVectorConcat &) = delete;
+  StdLogicVectorConcat & operator=(const StdLogicVectorConcat &) = delete;
+
+  int getLength() const;
+  operator StdLogicVector() const &&;
+};
+
+StdLogicVectorConcat operator&(const StdLogicVector & _first,
+    const StdLogicVector & _last);
+StdLogicVectorConcat operator&(StdLogicVectorConcat && _head,
+    const StdLogicVector & _last);
+
 #endif /* STDLOGICVECTOR_H_ */
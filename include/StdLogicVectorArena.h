@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorArena.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Pooled storage for the GMP limbs of StdLogicVectors
+ * @version 0.1
+ *
+ * StdLogicVectors wider than their inline limbs, as well as the temporaries
+ * of many GMP functions, obtain their storage from the C library. Simulations
+ * running many threads then spend a noticeable share of their time in (and
+ * waiting for) malloc(). This file provides the StdLogicVectorArena class,
+ * which installs thread-local pools as the memory functions of GMP and
+ * offers scoped arenas releasing all temporaries of a clock cycle at once.
+ */
+
+#ifndef STDLOGICVECTORARENA_H_
+#define STDLOGICVECTORARENA_H_
+
+#include <cstddef>
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorArena
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Pooled storage for the GMP limbs of StdLogicVectors
+ * @version 0.1
+ *
+ * Install() replaces the memory functions of GMP (see
+ * mp_set_memory_functions()) by thread-local free lists of power-of-two size
+ * classes, such that released storage is reused by the same thread without
+ * taking any lock. Since GMP requires its memory functions to be replaced
+ * before any allocation, Install() has to be called at the start of main().
+ * Storage returned by GMP (e.g., by mpz_get_str()) must then be released
+ * using the function returned by mp_get_memory_functions() instead of free().
+ *
+ * While a StdLogicVectorArena object exists, all new storage requested by GMP
+ * within its thread is instead taken from the chunks of the arena using a
+ * bump pointer, e.g.:
+ * @code
+ * for (int cycle = 0; cycle < cycles; ++cycle) {
+ *   StdLogicVectorArena scope;
+ *   // Temporaries of the cycle...
+ * }
+ * @endcode
+ * Releasing storage of the arena merely counts down the blocks of its chunk,
+ * and all chunks are recycled at once at the end of the scope. Storage still
+ * in use at that time (e.g., of a result moved out of the scope) stays valid;
+ * its chunk is only released together with the last of its blocks. Without
+ * Install(), an arena has no effect.
+ */
+class StdLogicVectorArena {
+
+public:
+  // Allocation statistics summed over all threads.
+  struct Statistics {
+    // Requests by GMP.
+    unsigned long long allocations;
+    unsigned long long reallocations;
+    unsigned long long frees;
+    // Requests served from a free list, from an arena and by the C library.
+    unsigned long long pooled;
+    unsigned long long arena;
+    unsigned long long system;
+  };
+
+  // Chunk of an arena (see StdLogicVectorArena.cpp).
+  struct Chunk;
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  StdLogicVectorArena * outer_;
+  Chunk * chunks_;
+  size_t used_;
+  size_t bytes_;
+
+  void * Allocate(size_t _size);
+
+  static void * AllocateFunction(size_t _size);
+  static void * ReallocateFunction(void * _ptr, size_t _oldSize,
+      size_t _newSize);
+  static void FreeFunction(void * _ptr, size_t);
+
+public:
+  // **************************************************************************
+  // Constructors/Destructors
+  // **************************************************************************
+  StdLogicVectorArena();
+  ~StdLogicVectorArena();
+
+  StdLogicVectorArena(const StdLogicVectorArena & _other) = delete;
+  StdLogicVectorArena & operator=(const StdLogicVectorArena & _other) = delete;
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  size_t getBytes() const;
+
+
+  // **************************************************************************
+  // Memory functions
+  // **************************************************************************
+  static void Install();
+  static bool isInstalled();
+  static Statistics getStatistics();
+};
+
+#endif /* STDLOGICVECTORARENA_H_ */
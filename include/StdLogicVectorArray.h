@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorArray.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A batch of StdLogicVectors of the same width
+ * @version 0.1
+ *
+ * Models processing many vectors of the same width at once (e.g., millions of
+ * 128-bit plaintexts) would otherwise keep each of them in a StdLogicVector of
+ * its own, i.e., in a separate heap block and with its own bookkeeping. This
+ * file provides the StdLogicVectorArray class, which stores all vectors in a
+ * single contiguous buffer and applies each operation to the whole batch.
+ */
+
+#ifndef STDLOGICVECTORARRAY_H_
+#define STDLOGICVECTORARRAY_H_
+
+#include <cstddef>
+#include <vector>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+#include "StdLogicVectorView.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorArray
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A batch of StdLogicVectors of the same width
+ * @version 0.1
+ *
+ * A StdLogicVectorArray holds a fixed number of vectors of the same length in
+ * a single, 64-byte aligned limb buffer (structure of arrays), each element
+ * occupying the same number of limbs. Elements are accessed as
+ * StdLogicVectorViews, while the bitwise and arithmetic operations process all
+ * elements at once. Since the elements never grow, all operations wrap around
+ * at the length of the array (see StdLogicVector::setWrapping()).
+ *
+ * Operations taking another StdLogicVectorArray as operand expect it to hold
+ * the same number of elements of the same length. Otherwise, the array is
+ * left unchanged.
+ */
+class StdLogicVectorArray {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  // Alignment of the limb buffer (i.e., the size of a cache line).
+  static const size_t kAlignment = 64;
+
+  mp_limb_t * limbs_;
+  size_t count_;
+  mp_size_t stride_;
+  int length_;
+
+  // **************************************************************************
+  // Storage functions
+  // **************************************************************************
+  static mp_limb_t * Allocate(size_t _count, mp_size_t _stride);
+  bool Matches(const StdLogicVectorArray & _operand) const;
+  void MaskElements();
+
+  friend class StdLogicVectorBitslice;
+  friend class StdULogicVector;
+
+public:
+  // **************************************************************************
+  // Constructors/Destructors
+  // **************************************************************************
+  StdLogicVectorArray();
+  StdLogicVectorArray(size_t _count, int _length);
+
+  StdLogicVectorArray(const StdLogicVectorArray & _other);
+  StdLogicVectorArray & operator=(const StdLogicVectorArray & _other);
+  StdLogicVectorArray(StdLogicVectorArray && _other) noexcept;
+  StdLogicVectorArray & operator=(StdLogicVectorArray && _other) noexcept;
+
+  ~StdLogicVectorArray();
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  size_t getCount() const;
+  int getLength() const;
+  mp_size_t getStride() const;
+  const mp_limb_t * getLimbs() const;
+
+  StdLogicVectorView operator[](size_t _index);
+  StdLogicVector getElement(size_t _index) const;
+
+
+  // **************************************************************************
+  // Bitwise operations
+  // **************************************************************************
+  StdLogicVectorArray & ShiftLeft(int _bits);
+  StdLogicVectorArray & ShiftRight(int _bits);
+  StdLogicVectorArray & And(const StdLogicVectorArray & _operand);
+  StdLogicVectorArray & Or(const StdLogicVectorArray & _operand);
+  StdLogicVectorArray & Xor(const StdLogicVectorArray & _operand);
+  StdLogicVectorArray & TruncateAfter(int _width);
+
+
+  // **************************************************************************
+  // Arithmetic operations
+  // **************************************************************************
+  StdLogicVectorArray & Add(const StdLogicVectorArray & _operand);
+
+
+  // **************************************************************************
+  // Comparison
+  // **************************************************************************
+  vector<size_t> FindMismatches(const StdLogicVectorArray & _expected,
+      const StdLogicVectorArray & _care) const;
+
+
+  // **************************************************************************
+  // Bit counting
+  // **************************************************************************
+  vector<int> PopCounts() const;
+  vector<int> HammingDistances(const StdLogicVectorArray & _operand) const;
+  mp_bitcnt_t HammingDistance(const StdLogicVectorArray & _operand) const;
+};
+
+#endif /* STDLOGICVECTORARRAY_H_ */
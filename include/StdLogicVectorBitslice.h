@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorBitslice.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A bitsliced batch of StdLogicVectors
+ * @version 0.1
+ *
+ * Exhaustively evaluating a bit-level model (e.g., an S-box or a round
+ * function) requires running the same sequence of operations over many
+ * independent inputs. This file provides the StdLogicVectorBitslice class,
+ * which keeps a batch of inputs in transposed (bitsliced) form, such that each
+ * bitwise operation processes all of them at once.
+ */
+
+#ifndef STDLOGICVECTORBITSLICE_H_
+#define STDLOGICVECTORBITSLICE_H_
+
+#include <cstddef>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+#include "StdLogicVectorView.h"
+#include "StdLogicVectorArray.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorBitslice
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A bitsliced batch of StdLogicVectors
+ * @version 0.1
+ *
+ * A StdLogicVectorBitslice holds a number of instances (lanes) of a vector of
+ * @a length bits in transposed form: slice @c i holds bit @c i of all
+ * instances, with instance @c j in lane (bit) @c j of the slice. Since the
+ * number of lanes is a multiple of 64, a single bitwise operation on the
+ * slices evaluates 64, 256 or 512 instances at once (i.e., one machine word,
+ * AVX2 or AVX-512 register per slice).
+ *
+ * Operations moving bits within a vector (e.g., ReplaceBits() or
+ * ReverseBitOrder()) merely move whole slices and are therefore just as cheap.
+ * Like a StdLogicVectorArray, the length of a bitslice never grows, i.e., all
+ * operations wrap around at its length.
+ */
+class StdLogicVectorBitslice {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  // Slice i is element i of the array, each element being one bit per lane.
+  StdLogicVectorArray slices_;
+
+  mp_limb_t * SliceLimbs(int _index);
+  const mp_limb_t * SliceLimbs(int _index) const;
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdLogicVectorBitslice();
+  StdLogicVectorBitslice(int _length, int _lanes);
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  int getLength() const;
+  int getLanes() const;
+
+  StdLogicVectorView Slice(int _index);
+  StdLogicVector getLane(int _lane) const;
+  void setLane(int _lane, const StdLogicVector & _value);
+
+
+  // **************************************************************************
+  // Transposition
+  // **************************************************************************
+  static StdLogicVectorBitslice FromArray(const StdLogicVectorArray & _inputs);
+  StdLogicVectorArray ToArray() const;
+
+
+  // **************************************************************************
+  // Bitwise operations
+  // **************************************************************************
+  StdLogicVectorBitslice & ShiftLeft(int _bits);
+  StdLogicVectorBitslice & ShiftRight(int _bits);
+  StdLogicVectorBitslice & And(const StdLogicVectorBitslice & _operand);
+  StdLogicVectorBitslice & Or(const StdLogicVectorBitslice & _operand);
+  StdLogicVectorBitslice & Xor(const StdLogicVectorBitslice & _operand);
+
+  StdLogicVectorBitslice & TruncateAfter(int _width);
+  StdLogicVectorBitslice & ReplaceBits(int _begin,
+      const StdLogicVectorBitslice & _input);
+  StdLogicVectorBitslice Extract(int _hi, int _lo) const;
+  StdLogicVectorBitslice & ReverseBitOrder();
+};
+
+#endif /* STDLOGICVECTORBITSLICE_H_ */
@@ -0,0 +1,571 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorExpression.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Expression templates for chains of bitwise StdLogicVector operations
+ * @version 0.1
+ *
+ * Since the operations of a StdLogicVector modify the vector in place,
+ * evaluating an expression such as @c And(a^b,c<<3) without destroying its
+ * operands requires copies of @c a and @c c, and each operation walks all the
+ * limbs of its vector once more. This file provides the operators @c ^, @c |,
+ * @c << and @c >>, as well as the function And(), which merely build a tree
+ * of the operations. The tree
+ * is evaluated in a single pass over the limbs of the result once it is
+ * assigned to a StdLogicVector, without creating any intermediate vector.
+ */
+
+#ifndef STDLOGICVECTOREXPRESSION_H_
+#define STDLOGICVECTOREXPRESSION_H_
+
+#include <algorithm>
+#include <type_traits>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+#include "StdLogicVectorKernels.h"
+#include "StdLogicVectorView.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorExpression
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief The base of all nodes of an expression tree
+ * @version 0.1
+ *
+ * An expression evaluates to the same value as the corresponding chain of
+ * operations on a copy of its leftmost operand, e.g., @c And(a^b,c<<3) yields
+ * @c StdLogicVector(a).Xor(b).And(StdLogicVector(c).ShiftLeft(3)). In
+ * particular, the result takes over the length and the wrapping mode of the
+ * leftmost operand.
+ *
+ * Each node provides the following functions, used while evaluating the
+ * tree: @c getLength() and @c isWrapping() of the result, @c getSize() as an
+ * upper bound of the number of limbs of its value, @c Evaluate() computing a
+ * block of limbs of its value, and @c Refers() determining whether a
+ * StdLogicVector is one of its operands. The tree is evaluated one block of
+ * kBlockLimbs limbs at a time, such that all intermediate values of a block
+ * remain within the L1 cache (and on the stack). Since @c Evaluate() may
+ * return the limbs of an operand instead of copying them, the limbs of the
+ * operands are read only once.
+ *
+ * The inner nodes are kept by value, while the operands (i.e., the leaves)
+ * are referenced. Thus, an expression may be stored using @c auto as long as
+ * its operands outlive it. Since the operator @c & denotes the VHDL
+ * concatenation (see StdLogicVectorConcat), a bitwise AND is always written
+ * using And(), regardless of whether its operands are StdLogicVectors or
+ * expressions.
+ *
+ * @tparam Expression The type of the node (i.e., the derived class).
+ */
+template <typename Expression>
+class StdLogicVectorExpression {
+
+public:
+  // Number of limbs evaluated at once.
+  static constexpr mp_size_t kBlockLimbs = 64;
+
+  /**
+   * @brief Returns the node as its derived type.
+   */
+  const Expression & getExpression() const {
+    return static_cast<const Expression &>(*this);
+  }
+
+  /**
+   * @brief Returns the number of limbs required for @p _width bits.
+   */
+  static mp_size_t LimbsForWidth(int _width) {
+    return (static_cast<mp_size_t>(_width) + GMP_NUMB_BITS - 1) /
+        GMP_NUMB_BITS;
+  }
+
+  /**
+   * @brief Clears the bits of a block of limbs at or beyond a given length.
+   * @param _limbs The block of limbs to be masked.
+   * @param _begin The index of the first limb of the block.
+   * @param _count The number of limbs of the block.
+   * @param _length The length beyond which all bits are cleared.
+   */
+  static void MaskLimbs(mp_limb_t * _limbs, mp_size_t _begin,
+      mp_size_t _count, int _length) {
+    mp_size_t valid = LimbsForWidth(_length) - _begin;
+
+    if ( valid >= _count &&
+         (_length % GMP_NUMB_BITS == 0 || valid > _count) ) {
+      return;
+    }
+    valid = max<mp_size_t>(valid, 0);
+    if ( valid > 0 && _length % GMP_NUMB_BITS != 0 ) {
+      _limbs[valid - 1] &=
+          (static_cast<mp_limb_t>(1) << (_length % GMP_NUMB_BITS)) - 1;
+    }
+    for (mp_size_t i = valid; i < _count; ++i) {
+      _limbs[i] = 0;
+    }
+  }
+
+  /**
+   * @brief Evaluates the limbs @p _begin to @p _begin + @p _count - 1 of an
+   *   operand, where limbs at negative indices are zero.
+   * @return The limbs of the operand (either @p _limbs or its own ones).
+   */
+  template <typename Operand>
+  static const mp_limb_t * EvaluateAt(const Operand & _operand,
+      mp_limb_t * _limbs, mp_size_t _begin, mp_size_t _count) {
+    mp_size_t skip = min(max<mp_size_t>(-_begin, 0), _count);
+    const mp_limb_t * limbs;
+
+    if ( skip == 0 ) {
+      return _operand.Evaluate(_limbs, _begin, _count);
+    }
+    for (mp_size_t i = 0; i < skip; ++i) {
+      _limbs[i] = 0;
+    }
+    if ( skip < _count ) {
+      limbs = _operand.Evaluate(_limbs + skip, 0, _count - skip);
+      if ( limbs != _limbs + skip ) {
+        mpn_copyi(_limbs + skip, limbs, _count - skip);
+      }
+    }
+    return _limbs;
+  }
+};
+
+/**
+ * @brief A StdLogicVector as an operand of an expression.
+ */
+class StdLogicVectorLeaf : public StdLogicVectorExpression<StdLogicVectorLeaf> {
+
+private:
+  const StdLogicVector * vector_;
+
+public:
+  explicit StdLogicVectorLeaf(const StdLogicVector & _vector) :
+      vector_(&_vector) {}
+
+  int getLength() const { return vector_->getLength(); }
+  bool isWrapping() const { return vector_->isWrapping(); }
+  mp_size_t getSize() const { return mpz_size(vector_->getValue()); }
+
+  const mp_limb_t * Evaluate(mp_limb_t * _limbs, mp_size_t _begin,
+      mp_size_t _count) const {
+    mp_size_t valid = min(max<mp_size_t>(getSize() - _begin, 0), _count);
+    const mp_limb_t * limbs = mpz_limbs_read(vector_->getValue());
+
+    // Only blocks reaching beyond the value are copied.
+    if ( valid == _count ) {
+      return limbs + _begin;
+    }
+    if ( valid > 0 ) {
+      mpn_copyi(_limbs, limbs + _begin, valid);
+    }
+    for (mp_size_t i = valid; i < _count; ++i) {
+      _limbs[i] = 0;
+    }
+    return _limbs;
+  }
+
+  bool Refers(const StdLogicVector & _vector) const {
+    return vector_ == &_vector;
+  }
+};
+
+/**
+ * @brief A StdLogicVectorView or StdLogicVectorConstView as an operand of an
+ *   expression. A view never wraps around.
+ */
+class StdLogicVectorViewLeaf :
+    public StdLogicVectorExpression<StdLogicVectorViewLeaf> {
+
+private:
+  StdLogicVectorConstView view_;
+
+public:
+  explicit StdLogicVectorViewLeaf(const StdLogicVectorConstView & _view) :
+      view_(_view) {}
+
+  int getLength() const { return view_.getLength(); }
+  bool isWrapping() const { return false; }
+  mp_size_t getSize() const { return LimbsForWidth(view_.getLength()); }
+
+  const mp_limb_t * Evaluate(mp_limb_t * _limbs, mp_size_t _begin,
+      mp_size_t _count) const {
+    for (mp_size_t i = 0; i < _count; ++i) {
+      _limbs[i] = view_.getLimb(_begin + i);
+    }
+    return _limbs;
+  }
+
+  bool Refers(const StdLogicVector & _vector) const {
+    return view_.Overlaps(_vector);
+  }
+};
+
+/**
+ * @brief The bitwise operations of a StdLogicVectorBinary node, using the
+ *   limb kernels selected for the host CPU. Only those operations which may
+ *   set bits beyond the length of the left operand (i.e., OR and XOR) mask
+ *   their result in wrapping mode.
+ */
+struct StdLogicVectorAndOp {
+  static constexpr bool kMasks = false;
+  static void Apply(mp_limb_t * _dst, const mp_limb_t * _a,
+      const mp_limb_t * _b, mp_size_t _n) {
+    ActiveBitwiseKernels().And(_dst, _a, _b, _n);
+  }
+  static mp_size_t Size(mp_size_t _a, mp_size_t _b) { return min(_a, _b); }
+};
+
+struct StdLogicVectorOrOp {
+  static constexpr bool kMasks = true;
+  static void Apply(mp_limb_t * _dst, const mp_limb_t * _a,
+      const mp_limb_t * _b, mp_size_t _n) {
+    ActiveBitwiseKernels().Or(_dst, _a, _b, _n);
+  }
+  static mp_size_t Size(mp_size_t _a, mp_size_t _b) { return max(_a, _b); }
+};
+
+struct StdLogicVectorXorOp {
+  static constexpr bool kMasks = true;
+  static void Apply(mp_limb_t * _dst, const mp_limb_t * _a,
+      const mp_limb_t * _b, mp_size_t _n) {
+    ActiveBitwiseKernels().Xor(_dst, _a, _b, _n);
+  }
+  static mp_size_t Size(mp_size_t _a, mp_size_t _b) { return max(_a, _b); }
+};
+
+/**
+ * @brief A bitwise operation of two expressions.
+ * @tparam Op The operation (StdLogicVectorAndOp, StdLogicVectorOrOp or
+ *   StdLogicVectorXorOp).
+ */
+template <typename Op, typename Left, typename Right>
+class StdLogicVectorBinary :
+    public StdLogicVectorExpression<StdLogicVectorBinary<Op, Left, Right> > {
+
+private:
+  Left left_;
+  Right right_;
+
+public:
+  StdLogicVectorBinary(const Left & _left, const Right & _right) :
+      left_(_left), right_(_right) {}
+
+  int getLength() const { return left_.getLength(); }
+  bool isWrapping() const { return left_.isWrapping(); }
+
+  mp_size_t getSize() const {
+    mp_size_t size = Op::Size(left_.getSize(), right_.getSize());
+
+    if ( Op::kMasks && isWrapping() ) {
+      size = min(size, this->LimbsForWidth(getLength()));
+    }
+    return size;
+  }
+
+  const mp_limb_t * Evaluate(mp_limb_t * _limbs, mp_size_t _begin,
+      mp_size_t _count) const {
+    mp_limb_t scratch[this->kBlockLimbs];
+    const mp_limb_t * left  = left_.Evaluate(_limbs, _begin, _count);
+    const mp_limb_t * right = right_.Evaluate(scratch, _begin, _count);
+
+    Op::Apply(_limbs, left, right, _count);
+    if ( Op::kMasks && isWrapping() ) {
+      this->MaskLimbs(_limbs, _begin, _count, getLength());
+    }
+    return _limbs;
+  }
+
+  bool Refers(const StdLogicVector & _vector) const {
+    return left_.Refers(_vector) || right_.Refers(_vector);
+  }
+};
+
+/**
+ * @brief A shift of an expression by a constant number of bits.
+ *
+ * Each block of a shifted expression requires an additional limb of its
+ * operand beyond the block, which is evaluated separately (i.e., nested shifts
+ * of deep expressions are rather expensive).
+ *
+ * @tparam Left True for a shift to the left, false for one to the right.
+ */
+template <bool Left, typename Operand>
+class StdLogicVectorShift :
+    public StdLogicVectorExpression<StdLogicVectorShift<Left, Operand> > {
+
+private:
+  Operand operand_;
+  mp_size_t limbShift_;
+  unsigned int bitShift_;
+
+public:
+  StdLogicVectorShift(const Operand & _operand, int _bits) :
+      operand_(_operand), limbShift_(max(_bits, 0) / GMP_NUMB_BITS),
+      bitShift_(max(_bits, 0) % GMP_NUMB_BITS) {}
+
+  int getLength() const { return operand_.getLength(); }
+  bool isWrapping() const { return operand_.isWrapping(); }
+
+  mp_size_t getSize() const {
+    mp_size_t size = operand_.getSize();
+
+    if ( !Left ) {
+      return max<mp_size_t>(size - limbShift_, 0);
+    }
+    if ( size == 0 ) {
+      return 0;
+    }
+    size += limbShift_ + (bitShift_ != 0);
+    if ( isWrapping() ) {
+      size = min(size, this->LimbsForWidth(getLength()));
+    }
+    return size;
+  }
+
+  const mp_limb_t * Evaluate(mp_limb_t * _limbs, mp_size_t _begin,
+      mp_size_t _count) const {
+    mp_limb_t scratch[this->kBlockLimbs];
+    mp_limb_t edge;
+    const mp_limb_t * limbs;
+
+    if ( Left ) {
+      limbs = this->EvaluateAt(operand_, scratch, _begin - limbShift_, _count);
+      if ( bitShift_ == 0 ) {
+        mpn_copyi(_limbs, limbs, _count);
+      } else {
+        // The limb of the operand below the block.
+        edge = *this->EvaluateAt(operand_, &edge, _begin - limbShift_ - 1, 1);
+        mpn_lshift(_limbs, limbs, _count, bitShift_);
+        _limbs[0] |= edge >> (GMP_NUMB_BITS - bitShift_);
+      }
+      if ( isWrapping() ) {
+        this->MaskLimbs(_limbs, _begin, _count, getLength());
+      }
+    } else {
+      limbs = operand_.Evaluate(scratch, _begin + limbShift_, _count);
+      if ( bitShift_ == 0 ) {
+        mpn_copyi(_limbs, limbs, _count);
+      } else {
+        // The limb of the operand above the block.
+        edge = *operand_.Evaluate(&edge, _begin + limbShift_ + _count, 1);
+        mpn_rshift(_limbs, limbs, _count, bitShift_);
+        _limbs[_count - 1] |= edge << (GMP_NUMB_BITS - bitShift_);
+      }
+    }
+    return _limbs;
+  }
+
+  bool Refers(const StdLogicVector & _vector) const {
+    return operand_.Refers(_vector);
+  }
+};
+
+
+// ****************************************************************************
+// Operand traits
+// ****************************************************************************
+/**
+ * @brief Maps the type of an operand to the type of its node, i.e.,
+ *   StdLogicVectors and StdLogicVectorViews to leaves and expressions to
+ *   themselves. Any other type is no operand.
+ */
+template <typename Operand, typename = void>
+struct StdLogicVectorOperand {
+  static const bool kIsOperand    = false;
+  static const bool kIsExpression = false;
+};
+
+template <>
+struct StdLogicVectorOperand<StdLogicVector> {
+  static const bool kIsOperand    = true;
+  static const bool kIsExpression = false;
+  typedef StdLogicVectorLeaf Node;
+};
+
+template <>
+struct StdLogicVectorOperand<StdLogicVectorConstView> {
+  static const bool kIsOperand    = true;
+  static const bool kIsExpression = false;
+  typedef StdLogicVectorViewLeaf Node;
+};
+
+template <>
+struct StdLogicVectorOperand<StdLogicVectorView> {
+  static const bool kIsOperand    = true;
+  static const bool kIsExpression = false;
+  typedef StdLogicVectorViewLeaf Node;
+};
+
+template <typename Operand>
+struct StdLogicVectorOperand<Operand, typename enable_if<
+    is_base_of<StdLogicVectorExpression<Operand>, Operand>::value>::type> {
+  static const bool kIsOperand    = true;
+  static const bool kIsExpression = true;
+  typedef Operand Node;
+};
+
+/**
+ * @brief Returns the node of an operand.
+ */
+inline StdLogicVectorLeaf ToNode(const StdLogicVector & _operand) {
+  return StdLogicVectorLeaf(_operand);
+}
+
+inline StdLogicVectorViewLeaf ToNode(
+    const StdLogicVectorConstView & _operand) {
+  return StdLogicVectorViewLeaf(_operand);
+}
+
+template <typename Expression>
+const Expression & ToNode(const StdLogicVectorExpression<Expression> & _operand)
+{
+  return _operand.getExpression();
+}
+
+// The type of a bitwise operation of two operands, available only if both are
+// operands.
+template <typename Op, typename Left, typename Right>
+using StdLogicVectorBinaryOf = typename enable_if<
+    StdLogicVectorOperand<Left>::kIsOperand &&
+    StdLogicVectorOperand<Right>::kIsOperand,
+    StdLogicVectorBinary<Op, typename StdLogicVectorOperand<Left>::Node,
+        typename StdLogicVectorOperand<Right>::Node> >::type;
+
+// The type of a shift of an operand.
+template <bool ShiftsLeft, typename Operand>
+using StdLogicVectorShiftOf = typename enable_if<
+    StdLogicVectorOperand<Operand>::kIsOperand,
+    StdLogicVectorShift<ShiftsLeft,
+        typename StdLogicVectorOperand<Operand>::Node> >::type;
+
+
+// ****************************************************************************
+// Operators
+// ****************************************************************************
+/**
+ * @brief Bitwise AND of two operands. Unlike OR and XOR, the AND has no
+ *   operator, since @c a @c & @c b denotes a concatenation.
+ */
+template <typename Left, typename Right>
+StdLogicVectorBinaryOf<StdLogicVectorAndOp, Left, Right> And(
+    const Left & _left, const Right & _right) {
+  return StdLogicVectorBinaryOf<StdLogicVectorAndOp, Left, Right>(
+      ToNode(_left), ToNode(_right));
+}
+
+/**
+ * @brief Bitwise OR of two operands.
+ */
+template <typename Left, typename Right>
+StdLogicVectorBinaryOf<StdLogicVectorOrOp, Left, Right> operator|(
+    const Left & _left, const Right & _right) {
+  return StdLogicVectorBinaryOf<StdLogicVectorOrOp, Left, Right>(
+      ToNode(_left), ToNode(_right));
+}
+
+/**
+ * @brief Bitwise XOR of two operands.
+ */
+template <typename Left, typename Right>
+StdLogicVectorBinaryOf<StdLogicVectorXorOp, Left, Right> operator^(
+    const Left & _left, const Right & _right) {
+  return StdLogicVectorBinaryOf<StdLogicVectorXorOp, Left, Right>(
+      ToNode(_left), ToNode(_right));
+}
+
+/**
+ * @brief Shift left of an operand by @p _bits bits.
+ */
+template <typename Operand>
+StdLogicVectorShiftOf<true, Operand> operator<<(const Operand & _operand,
+    int _bits) {
+  return StdLogicVectorShiftOf<true, Operand>(ToNode(_operand), _bits);
+}
+
+/**
+ * @brief Shift right of an operand by @p _bits bits.
+ */
+template <typename Operand>
+StdLogicVectorShiftOf<false, Operand> operator>>(const Operand & _operand,
+    int _bits) {
+  return StdLogicVectorShiftOf<false, Operand>(ToNode(_operand), _bits);
+}
+
+
+// ****************************************************************************
+// Evaluation
+// ****************************************************************************
+/**
+ * @brief Creates a StdLogicVector holding the value of an expression.
+ * @param _expression The expression to be evaluated.
+ */
+template <typename Expression>
+StdLogicVector::StdLogicVector(
+    const StdLogicVectorExpression<Expression> & _expression) :
+    length_(0), isDontCare_(false), isWrapping_(false)
+{
+  InitInline();
+  *this = _expression;
+}
+
+/**
+ * @brief Assigns the value of an expression, computing the result one block
+ *   of limbs at a time. If the StdLogicVector is an operand of the
+ *   expression itself, the expression is evaluated into a temporary first.
+ * @param _expression The expression to be evaluated.
+ * @return The StdLogicVector holding the value of the expression.
+ */
+template <typename Expression>
+StdLogicVector & StdLogicVector::operator=(
+    const StdLogicVectorExpression<Expression> & _expression) {
+  const Expression & expression = _expression.getExpression();
+  mp_size_t size;
+  mp_limb_t * limbs;
+
+  if ( expression.Refers(*this) ) {
+    return *this = StdLogicVector(_expression);
+  }
+
+  length_     = expression.getLength();
+  isDontCare_ = false;
+  isWrapping_ = expression.isWrapping();
+  size        = expression.getSize();
+  limbs       = ModifyLimbs(size);
+  for (mp_size_t i = 0; i < size; i += _expression.kBlockLimbs) {
+    mp_size_t count = min(_expression.kBlockLimbs, size - i);
+    const mp_limb_t * block = expression.Evaluate(limbs + i, i, count);
+
+    if ( block != limbs + i ) {
+      mpn_copyi(limbs + i, block, count);
+    }
+  }
+  FinishLimbs(size);
+
+  return *this;
+}
+
+#endif /* STDLOGICVECTOREXPRESSION_H_ */
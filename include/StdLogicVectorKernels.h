@@ -0,0 +1,183 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorKernels.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Limb kernels selected at runtime for the host CPU
+ * @version 0.1
+ *
+ * The bitwise operations of the StdLogicVector and StdLogicVectorArray classes
+ * work on plain, unsigned limb arrays. This file provides several
+ * implementations of these limb operations (a portable one as well as AVX2
+ * and AVX-512 ones), of which the fastest one supported by the host CPU is
+ * selected once at runtime. Thus, a single build of the library runs on all
+ * hosts, while still using the widest vector units available. The same holds
+ * for the kernels of the nine-valued logic of the StdULogicVector class.
+ *
+ * The carry-less multiplication (i.e., the multiplication of polynomials over
+ * GF(2)) is selected the same way, using the PCLMULQDQ instruction or its
+ * AVX-512 form VPCLMULQDQ where available. So are the population counts,
+ * using the POPCNT instruction or AVX-512 VPOPCNTDQ. The kernels reordering
+ * bits within limbs use the byte shuffle of SSSE3 (pshufb) where available.
+ *
+ * The carry-propagating kernels of the arithmetic operations need no vector
+ * units. Instead, operands of up to kUnrolledLimbs limbs are handled by fully
+ * unrolled carry chains, which avoids the call and loop overhead of the
+ * generic GMP functions for the widths common in hardware models.
+ */
+
+#ifndef STDLOGICVECTORKERNELS_H_
+#define STDLOGICVECTORKERNELS_H_
+
+#include <gmp.h>
+
+using namespace std;
+
+/**
+ * @struct BitwiseKernels
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A set of limb kernels for the unsigned bitwise operations
+ * @version 0.1
+ *
+ * Each kernel computes @c _dst[i] = @c _a[i] @c op @c _b[i] for @p _n limbs.
+ * The destination may be identical to either of the sources.
+ */
+struct BitwiseKernels {
+  const char * name;
+  void (*And)(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+      mp_size_t _n);
+  void (*Or)(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+      mp_size_t _n);
+  void (*Xor)(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+      mp_size_t _n);
+  // Returns the index of the first limb where _a and _b differ in any bit set
+  // in _care, or _n if there is none.
+  mp_size_t (*FindMismatch)(const mp_limb_t * _a, const mp_limb_t * _b,
+      const mp_limb_t * _care, mp_size_t _n);
+};
+
+const BitwiseKernels & ActiveBitwiseKernels();
+int AvailableBitwiseKernels(const BitwiseKernels * _kernels[], int _max);
+
+// Kernels of the nine-valued logic of a StdULogicVector, working on four bit
+// planes (value, unknown, weak and special) stored @p _stride limbs apart.
+// The stride must be a multiple of kULogicBlockLimbs and the planes must be
+// aligned to 64 bytes. The result replaces the planes of @p _a.
+static const mp_size_t kULogicBlockLimbs = 8;
+
+struct ULogicKernels {
+  const char * name;
+  void (*And)(mp_limb_t * _a, const mp_limb_t * _b, mp_size_t _stride);
+  void (*Or)(mp_limb_t * _a, const mp_limb_t * _b, mp_size_t _stride);
+  void (*Xor)(mp_limb_t * _a, const mp_limb_t * _b, mp_size_t _stride);
+  void (*Resolve)(mp_limb_t * _a, const mp_limb_t * _b, mp_size_t _stride);
+  void (*Not)(mp_limb_t * _a, mp_size_t _stride);
+};
+
+const ULogicKernels & ActiveULogicKernels();
+int AvailableULogicKernels(const ULogicKernels * _kernels[], int _max);
+
+// Kernels counting the set bits of _n limbs of _a, or of _a ^ _b if _b is not
+// NULL (i.e., the Hamming distance). PopCounts() counts the bits of each of
+// _count elements of _stride limbs separately.
+struct PopCountKernels {
+  const char * name;
+  mp_bitcnt_t (*PopCount)(const mp_limb_t * _a, const mp_limb_t * _b,
+      mp_size_t _n);
+  void (*PopCounts)(int * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+      size_t _count, mp_size_t _stride);
+};
+
+const PopCountKernels & ActivePopCountKernels();
+int AvailablePopCountKernels(const PopCountKernels * _kernels[], int _max);
+
+// Kernels reordering the bits or digits of limbs. Reverse() reverses the bit
+// order of _n limbs in place, i.e., bit i is moved to bit
+// _n * GMP_NUMB_BITS - 1 - i. FormatHex() writes the hexadecimal digits of _n
+// limbs to _dst (most significant digit first, GMP_NUMB_BITS / 4 per limb),
+// looking them up in the 16 characters of _digits. ParseHex() and
+// ParseBinary() do the reverse for up to _n limbs of the digits ending at
+// _end, starting with the least significant limb. They stop at the first limb
+// containing a character other than a digit (case-insensitive) and return the
+// number of limbs written.
+struct ShuffleKernels {
+  const char * name;
+  void (*Reverse)(mp_limb_t * _limbs, mp_size_t _n);
+  void (*FormatHex)(char * _dst, const mp_limb_t * _limbs, mp_size_t _n,
+      const char * _digits);
+  mp_size_t (*ParseHex)(mp_limb_t * _limbs, const char * _end, mp_size_t _n);
+  mp_size_t (*ParseBinary)(mp_limb_t * _limbs, const char * _end,
+      mp_size_t _n);
+};
+
+const ShuffleKernels & ActiveShuffleKernels();
+int AvailableShuffleKernels(const ShuffleKernels * _kernels[], int _max);
+
+// Carry-propagating kernels of the arithmetic operations. All of them require
+// at least one limb per operand. The multiplications must not write to the
+// limbs of an operand, while the additions and subtractions may.
+static const mp_size_t kUnrolledLimbs = 512 / GMP_NUMB_BITS;
+
+mp_limb_t AddLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n);
+mp_limb_t SubLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n);
+// Computes the _n least significant limbs of the product. The scratch must
+// hold 2 * _n limbs.
+void MulLowLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n, mp_limb_t * _scratch);
+// Computes the full product of _an + _bn limbs. Squares if _a equals _b.
+void MulLimbs(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _an,
+    const mp_limb_t * _b, mp_size_t _bn);
+// Computes the _n most significant limbs of the product up to one too small,
+// omitting the partial products below limb _n - 2 (as needed by Barrett
+// reduction). The scratch must hold 2 * _n limbs.
+void MulHighLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n, mp_limb_t * _scratch);
+// Computes _a * _b * 2^(-64 * _n) mod _m for _a, _b < _m, _m being odd and
+// _mPrime = -_m^-1 mod 2^64. The scratch must hold 2 * _n limbs. The
+// destination may be identical to either of the sources.
+void MontMulLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    const mp_limb_t * _m, mp_limb_t _mPrime, mp_size_t _n,
+    mp_limb_t * _scratch);
+
+// Kernels of the carry-less multiplication. Each computes the full product of
+// _an + _bn limbs by schoolbook multiplication and must not write to the limbs
+// of an operand.
+struct ClMulKernels {
+  const char * name;
+  void (*Mul)(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _an,
+      const mp_limb_t * _b, mp_size_t _bn);
+};
+
+const ClMulKernels & ActiveClMulKernels();
+int AvailableClMulKernels(const ClMulKernels * _kernels[], int _max);
+
+// Computes the full carry-less product of _an + _bn limbs, using Karatsuba
+// multiplication on top of the active kernel for wide operands.
+void ClMulLimbs(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _an,
+    const mp_limb_t * _b, mp_size_t _bn);
+// Computes the carry-less square of 2 * _n limbs.
+void ClSquareLimbs(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _n);
+
+#endif /* STDLOGICVECTORKERNELS_H_ */
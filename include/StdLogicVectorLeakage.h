@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorLeakage.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Simulated power traces of StdLogicVector models
+ * @version 0.1
+ *
+ * Side-channel evaluations (DPA/CPA) of cryptographic cores are often first
+ * carried out on simulated power traces, where the power consumption of each
+ * cycle is modelled by the Hamming weight or Hamming distance of the
+ * intermediate values. This file provides the StdLogicVectorLeakage class,
+ * which collects the intermediate values registered by a bit-true model and
+ * streams the resulting traces into a compact binary file.
+ */
+
+#ifndef STDLOGICVECTORLEAKAGE_H_
+#define STDLOGICVECTORLEAKAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <vector>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorLeakage
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Simulated power traces of StdLogicVector models
+ * @version 0.1
+ *
+ * A StdLogicVectorLeakage records a single trace of a fixed number of
+ * samples. The model registers a probe for each leaking register using
+ * AddProbe() and reports the values of the probes within each cycle using
+ * Leak(). Clock() completes the cycle and stores its sample, being the sum of
+ * the Hamming weights (or of the Hamming distances to the previous values) of
+ * all probes reported within the cycle, plus optional Gaussian noise.
+ *
+ * After the probes have been added, recording a trace does not allocate any
+ * memory, such that GenerateTraces() produces millions of traces using one
+ * copy of the StdLogicVectorLeakage per thread.
+ */
+class StdLogicVectorLeakage {
+
+public:
+  // Power model of a single probe.
+  enum Model { kHammingWeight, kHammingDistance };
+
+  // Type of the samples within a trace file.
+  enum SampleFormat { kFloat32, kInt16 };
+
+  // Model computing a single trace (with the index of the trace).
+  typedef function<void(size_t _trace, StdLogicVectorLeakage & _leakage)>
+      TraceModel;
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  // Limbs of a probe within the limb buffers, and its length in bits.
+  struct Probe {
+    size_t offset;
+    mp_size_t size;
+    int length;
+  };
+
+  Model model_;
+  double noise_;
+  vector<float> samples_;
+  int cycle_;
+  mp_bitcnt_t leakage_;
+  vector<Probe> probes_;
+  // Values of the probes at the start of each trace and in the last cycle,
+  // and the scratch limbs of the value reported to Leak().
+  vector<mp_limb_t> initial_;
+  vector<mp_limb_t> previous_;
+  vector<mp_limb_t> current_;
+  // State of the xoshiro256+ generator and the second Gaussian of each pair.
+  uint64_t random_[4];
+  double spare_;
+  bool hasSpare_;
+
+  static void Load(mp_limb_t * _dst, const Probe & _probe,
+      const StdLogicVector & _value);
+  double Gaussian();
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdLogicVectorLeakage(Model _model, int _samples, double _noise);
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  Model getModel() const;
+  int getSampleCount() const;
+  double getNoise() const;
+  int getCycle() const;
+  const float * getSamples() const;
+
+
+  // **************************************************************************
+  // Recording
+  // **************************************************************************
+  int AddProbe(const StdLogicVector & _initial);
+  void Reset(uint64_t _seed);
+  void Leak(int _probe, const StdLogicVector & _value);
+  void Clock();
+
+
+  // **************************************************************************
+  // Trace files
+  // **************************************************************************
+  static const size_t kHeaderSize = 32;
+
+  bool GenerateTraces(ostream & _os, size_t _traces, uint64_t _seed,
+      SampleFormat _format, float _scale, int _threads,
+      const TraceModel & _trace) const;
+};
+
+#endif /* STDLOGICVECTORLEAKAGE_H_ */
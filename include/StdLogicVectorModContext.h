@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorModContext.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Modular arithmetic on StdLogicVectors for a fixed modulus
+ * @version 0.1
+ *
+ * Models of RSA and ECC datapaths perform millions of modular
+ * multiplications with the same modulus. Reducing each product using a
+ * generic division is far too slow for that. This file provides the
+ * StdLogicVectorModContext class, which precomputes the Montgomery and
+ * Barrett constants of a modulus once and then offers fast modular
+ * operations, as well as a bit-true radix-2^k Montgomery multiplication
+ * matching the intermediate values of a hardware implementation.
+ */
+
+#ifndef STDLOGICVECTORMODCONTEXT_H_
+#define STDLOGICVECTORMODCONTEXT_H_
+
+#include <vector>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorModContext
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Modular arithmetic on StdLogicVectors for a fixed modulus
+ * @version 0.1
+ *
+ * All results are reduced modulo the modulus n and have the length of the
+ * modulus vector. Operands may be of any length; operands not below n are
+ * reduced first. ModMul(), MontMul() and ModExp() can also write to an
+ * existing StdLogicVector (which may be one of the operands), reusing its
+ * storage in loops.
+ *
+ * The Montgomery radix is R = 2^(64 * s), s being the number of 64-bit limbs
+ * of n (MontMulRadix() also takes R = 2^(k * iterations) for k-bit digits).
+ * The Montgomery operations (ToMontgomery(), FromMontgomery(), MontMul(),
+ * MontMulRadix() and ModExp()) require an odd modulus; ModExp() falls back to
+ * GMP for even moduli. ModMul() uses Barrett reduction and therefore works
+ * for any modulus without converting its operands.
+ */
+class StdLogicVectorModContext {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  StdLogicVector modulus_;
+  mp_size_t size_;
+  // Montgomery constants: -n^-1 mod 2^64, R mod n and R^2 mod n.
+  mp_limb_t nPrime_;
+  vector<mp_limb_t> r_;
+  vector<mp_limb_t> r2_;
+  // Barrett constants: floor((2^(128 * s) - 1) / n) and n, s + 1 limbs each.
+  vector<mp_limb_t> mu_;
+  vector<mp_limb_t> nBarrett_;
+
+  const mp_limb_t * ModulusLimbs() const;
+  void Load(mp_limb_t * _dst, const StdLogicVector & _operand) const;
+  const mp_limb_t * Read(const StdLogicVector & _operand,
+      mp_limb_t * _scratch) const;
+  StdLogicVector Store(const mp_limb_t * _src) const;
+  void Store(const mp_limb_t * _src, StdLogicVector & _result) const;
+  void ReduceLimbs(mp_limb_t * _dst, const mp_limb_t * _src, mp_size_t _size,
+      mp_limb_t * _scratch) const;
+  void MontMulLimbs(mp_limb_t * _dst, const mp_limb_t * _a,
+      const mp_limb_t * _b, mp_limb_t * _scratch) const;
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdLogicVectorModContext(const StdLogicVector & _modulus);
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  const StdLogicVector & getModulus() const;
+  int getLength() const;
+  bool isOdd() const;
+  StdLogicVector getR() const;
+  StdLogicVector getR2() const;
+  unsigned long long getNPrime() const;
+
+
+  // **************************************************************************
+  // Modular operations
+  // **************************************************************************
+  StdLogicVector Reduce(const StdLogicVector & _operand) const;
+  StdLogicVector ModAdd(const StdLogicVector & _a, const StdLogicVector & _b)
+      const;
+  StdLogicVector ModSub(const StdLogicVector & _a, const StdLogicVector & _b)
+      const;
+  StdLogicVector ModMul(const StdLogicVector & _a, const StdLogicVector & _b)
+      const;
+  void ModMul(const StdLogicVector & _a, const StdLogicVector & _b,
+      StdLogicVector & _result) const;
+  StdLogicVector ModExp(const StdLogicVector & _base,
+      const StdLogicVector & _exponent) const;
+  void ModExp(const StdLogicVector & _base, const StdLogicVector & _exponent,
+      StdLogicVector & _result) const;
+  bool ModInv(const StdLogicVector & _a, StdLogicVector & _result) const;
+
+
+  // **************************************************************************
+  // Montgomery operations
+  // **************************************************************************
+  StdLogicVector ToMontgomery(const StdLogicVector & _a) const;
+  StdLogicVector FromMontgomery(const StdLogicVector & _a) const;
+  StdLogicVector MontMul(const StdLogicVector & _a, const StdLogicVector & _b)
+      const;
+  void MontMul(const StdLogicVector & _a, const StdLogicVector & _b,
+      StdLogicVector & _result) const;
+  StdLogicVector MontMulRadix(const StdLogicVector & _a,
+      const StdLogicVector & _b, int _radixBits,
+      vector<StdLogicVector> * _trace) const;
+  StdLogicVector MontMulRadix(const StdLogicVector & _a,
+      const StdLogicVector & _b, int _radixBits, int _iterations,
+      vector<StdLogicVector> * _trace) const;
+};
+
+#endif /* STDLOGICVECTORMODCONTEXT_H_ */
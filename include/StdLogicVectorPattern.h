@@ -0,0 +1,94 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorPattern.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief An expected StdLogicVector value with per-bit don't cares
+ * @version 0.1
+ *
+ * The don't-care flag of a StdLogicVector applies to the vector as a whole.
+ * Response checkers, however, usually expect values such as "1--0", where only
+ * some of the bits are relevant. This file provides the StdLogicVectorPattern
+ * class, which attaches a care mask to an expected value.
+ */
+
+#ifndef STDLOGICVECTORPATTERN_H_
+#define STDLOGICVECTORPATTERN_H_
+
+#include <string>
+#include <string_view>
+
+#include "StdLogicVector.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorPattern
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief An expected StdLogicVector value with per-bit don't cares
+ * @version 0.1
+ *
+ * A StdLogicVectorPattern consists of an expected value and a care mask of
+ * the same length, the latter holding a 1 for each bit to be compared. The
+ * bits of the expected value not set in the care mask are always 0.
+ *
+ * Large numbers of responses are best checked using
+ * StdLogicVectorArray::FindMismatches(), with the expected values and care
+ * masks of the patterns kept in two arrays.
+ */
+class StdLogicVectorPattern {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  StdLogicVector value_;
+  StdLogicVector care_;
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdLogicVectorPattern();
+  StdLogicVectorPattern(const StdLogicVector & _value);
+  StdLogicVectorPattern(const StdLogicVector & _value,
+      const StdLogicVector & _care);
+  StdLogicVectorPattern(string_view _pattern, int _base, unsigned int _length);
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  int getLength() const;
+  const StdLogicVector & getValue() const;
+  const StdLogicVector & getCare() const;
+
+
+  // **************************************************************************
+  // Utility functions
+  // **************************************************************************
+  bool Matches(const StdLogicVector & _actual) const;
+  string ToString() const;
+};
+
+#endif /* STDLOGICVECTORPATTERN_H_ */
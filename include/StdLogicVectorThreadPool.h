@@ -0,0 +1,184 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorThreadPool.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Parallel operations on batches of StdLogicVectors
+ * @version 0.1
+ *
+ * Regressions applying a model to many independent test vectors are
+ * embarrassingly parallel. This file provides the StdLogicVectorThreadPool
+ * class, a work-stealing thread pool offering ParallelFor(),
+ * ParallelForEach() and ParallelMap() over batches of vectors, such that
+ * models do not need a thread loop of their own.
+ */
+
+#ifndef STDLOGICVECTORTHREADPOOL_H_
+#define STDLOGICVECTORTHREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "StdLogicVectorArray.h"
+#include "StdLogicVectorView.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorThreadPool
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Parallel operations on batches of StdLogicVectors
+ * @version 0.1
+ *
+ * ParallelFor() splits a range of indices into subranges, which the worker
+ * threads split further on demand: each worker keeps the subranges it has
+ * split off in a deque of its own, from which idle workers steal the oldest
+ * (i.e., largest) ones. Every index is processed exactly once, and
+ * ParallelMap() stores each result at the index of its input, such that the
+ * results do not depend on the number of threads or on the scheduling.
+ *
+ * The functions passed to the parallel operations are called concurrently.
+ * They may safely call const member functions (e.g., ToString(), ToULL() or
+ * TestBit()) of StdLogicVectors shared among all calls, and modify the
+ * element (or index) they have been called for. They may also start nested
+ * parallel operations, during which the calling worker helps executing the
+ * pending subranges. The first exception thrown by a function is rethrown by
+ * the parallel operation once all other subranges have been completed.
+ */
+class StdLogicVectorThreadPool {
+
+public:
+  // Function processing the indices [_begin, _end) of a parallel operation.
+  typedef function<void(size_t _begin, size_t _end)> RangeFunction;
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  // Parallel operation and deque of a worker (see
+  // StdLogicVectorThreadPool.cpp).
+  struct Job;
+  struct WorkerQueue;
+
+  // Subrange of the indices of a job.
+  struct Range {
+    Job * job;
+    size_t begin;
+    size_t end;
+  };
+
+  vector<WorkerQueue *> queues_;
+  vector<thread> threads_;
+  // Number of subranges within all queues and number of sleeping workers.
+  atomic<size_t> queued_;
+  atomic<int> sleeping_;
+  atomic<bool> stopping_;
+  mutex mutex_;
+  condition_variable wakeup_;
+
+  void Push(int _worker, const Range & _range);
+  bool Pop(int _worker, Range & _range);
+  bool Steal(int _worker, Range & _range);
+  void Execute(int _worker, Range _range);
+  void Work(int _worker);
+  int CurrentWorker() const;
+
+public:
+  // **************************************************************************
+  // Constructors/Destructors
+  // **************************************************************************
+  explicit StdLogicVectorThreadPool(int _threads);
+  ~StdLogicVectorThreadPool();
+
+  StdLogicVectorThreadPool(const StdLogicVectorThreadPool & _other) = delete;
+  StdLogicVectorThreadPool & operator=(const StdLogicVectorThreadPool & _other)
+      = delete;
+
+  static StdLogicVectorThreadPool & getDefault();
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  int getThreadCount() const;
+
+
+  // **************************************************************************
+  // Parallel operations
+  // **************************************************************************
+  void ParallelFor(size_t _count, size_t _grain, const RangeFunction & _func);
+
+  /**
+   * @brief Calls @p _func for each element of @p _items (in parallel).
+   */
+  template <typename Item, typename Func>
+  void ParallelForEach(vector<Item> & _items, Func _func) {
+    ParallelFor(_items.size(), 0, [&](size_t _begin, size_t _end) {
+      for (size_t i = _begin; i < _end; ++i) {
+        _func(_items[i]);
+      }
+    });
+  }
+
+  /**
+   * @brief Calls @p _func with a StdLogicVectorView of each element of
+   *   @p _array (in parallel).
+   */
+  template <typename Func>
+  void ParallelForEach(StdLogicVectorArray & _array, Func _func) {
+    ParallelFor(_array.getCount(), 0, [&](size_t _begin, size_t _end) {
+      for (size_t i = _begin; i < _end; ++i) {
+        _func(_array[i]);
+      }
+    });
+  }
+
+  /**
+   * @brief Applies @p _func to each element of @p _inputs (in parallel).
+   * @return The results, in the order of the inputs. The type of the results
+   *   must be default-constructible.
+   */
+  template <typename Input, typename Func>
+  auto ParallelMap(const vector<Input> & _inputs, Func _func)
+      -> vector<typename decay<decltype(_func(_inputs[0]))>::type> {
+    typedef typename decay<decltype(_func(_inputs[0]))>::type Result;
+    static_assert(!is_same<Result, bool>::value,
+        "vector<bool> cannot be written concurrently, map to char instead");
+    vector<Result> results(_inputs.size());
+
+    ParallelFor(_inputs.size(), 0, [&](size_t _begin, size_t _end) {
+      for (size_t i = _begin; i < _end; ++i) {
+        results[i] = _func(_inputs[i]);
+      }
+    });
+    return results;
+  }
+};
+
+#endif /* STDLOGICVECTORTHREADPOOL_H_ */
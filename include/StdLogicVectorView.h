@@ -0,0 +1,177 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorView.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A non-owning view onto a range of bits of a StdLogicVector
+ * @version 0.1
+ *
+ * Reading or writing a sub-range of a wide StdLogicVector (e.g., a single byte
+ * of a 1600-bit Keccak state) would otherwise require a full copy of the
+ * vector followed by shifting and truncating it. This file provides the
+ * StdLogicVectorView class, which refers to the bits of a StdLogicVector
+ * directly, analogous to the VHDL slice @c a(hi @c downto @c lo), as well as
+ * the read-only StdLogicVectorConstView for const StdLogicVectors.
+ */
+
+#ifndef STDLOGICVECTORVIEW_H_
+#define STDLOGICVECTORVIEW_H_
+
+#include <string>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+
+using namespace std;
+
+/**
+ * @class StdLogicVectorConstView
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A read-only view onto a range of bits of a StdLogicVector
+ * @version 0.1
+ *
+ * A StdLogicVectorConstView refers to the bits @c hi @c downto @c lo of a
+ * parent StdLogicVector without copying them, but only allows reading them.
+ * It is returned by StdLogicVector::Slice() for const StdLogicVectors. Every
+ * StdLogicVectorView is a StdLogicVectorConstView as well.
+ *
+ * A view must not outlive its parent.
+ */
+class StdLogicVectorConstView {
+
+protected:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  const StdLogicVector * parent_;
+  const mp_limb_t * limbs_;
+  mp_size_t size_;
+  int lo_;
+  int length_;
+
+  StdLogicVectorConstView(const mp_limb_t * _limbs, mp_size_t _size,
+      int _length);
+
+  const mp_limb_t * ReadLimbs() const;
+  mp_size_t ReadSize() const;
+
+  friend class StdLogicVectorArray;
+  friend class StdLogicVectorView;
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdLogicVectorConstView(const StdLogicVector & _parent, int _hi, int _lo);
+  StdLogicVectorConstView(const StdLogicVectorConstView & _other) = default;
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  int getLength() const;
+  int getLow() const;
+  const StdLogicVector * getParent() const;
+  bool Overlaps(const StdLogicVector & _vector) const;
+  mp_limb_t getLimb(mp_size_t _index) const;
+
+
+  // **************************************************************************
+  // Utility functions
+  // **************************************************************************
+  unsigned long long ToULL() const;
+
+  string ToString(int _base) const;
+  string ToString(int _base, bool _pad) const;
+
+  StdLogicVector ToStdLogicVector() const;
+
+
+  // **************************************************************************
+  // Operator overloadings
+  // **************************************************************************
+  bool operator==(const StdLogicVectorConstView & _input) const;
+  bool operator!=(const StdLogicVectorConstView & _input) const;
+  bool operator==(const StdLogicVector & _input) const;
+  bool operator!=(const StdLogicVector & _input) const;
+  friend ostream & operator<<(ostream & _os,
+      const StdLogicVectorConstView & _view);
+
+
+  // **************************************************************************
+  // Bitwise operations
+  // **************************************************************************
+  int TestBit(int _index) const;
+};
+
+/**
+ * @class StdLogicVectorView
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A non-owning view onto a range of bits of a StdLogicVector
+ * @version 0.1
+ *
+ * A StdLogicVectorView refers to the bits @c hi @c downto @c lo of a parent
+ * StdLogicVector without copying them. Reading the view reads the bits of the
+ * parent, and assigning to the view writes the bits of the parent. Views may
+ * also be passed as operands to StdLogicVector::And(), StdLogicVector::Or(),
+ * StdLogicVector::Xor() and StdLogicVector::Add().
+ *
+ * A view must not outlive its parent. Note that assigning to a view always
+ * writes through to the parent and never rebinds the view. Besides referring
+ * to a StdLogicVector, a view may also refer to an element of a
+ * StdLogicVectorArray.
+ */
+class StdLogicVectorView : public StdLogicVectorConstView {
+
+private:
+  StdLogicVectorView(mp_limb_t * _limbs, mp_size_t _size, int _length);
+
+  mp_limb_t * BeginWrite(mp_size_t & _size);
+  void EndWrite(mp_size_t _size);
+
+  friend class StdLogicVectorArray;
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdLogicVectorView(StdLogicVector & _parent, int _hi, int _lo);
+  StdLogicVectorView(const StdLogicVectorView & _other) = default;
+
+
+  // **************************************************************************
+  // Operator overloadings
+  // **************************************************************************
+  StdLogicVectorView & operator=(const StdLogicVectorView & _input);
+  StdLogicVectorView & operator=(const StdLogicVectorConstView & _input);
+  StdLogicVectorView & operator=(const StdLogicVector & _input);
+  StdLogicVectorView & operator=(unsigned long long _value);
+};
+
+bool operator==(const StdLogicVector & _input,
+    const StdLogicVectorConstView & _view);
+bool operator!=(const StdLogicVector & _input,
+    const StdLogicVectorConstView & _view);
+
+#endif /* STDLOGICVECTORVIEW_H_ */
@@ -0,0 +1,140 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdULogicVector.h
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A nine-valued std_ulogic_vector as defined by IEEE 1164
+ * @version 0.1
+ *
+ * The StdLogicVector class models two-valued bits only (plus a single
+ * don't-care flag for the whole vector). This file provides the
+ * StdULogicVector class, which holds one of the nine IEEE 1164 values @c U,
+ * @c X, @c 0, @c 1, @c Z, @c W, @c L, @c H and @c - per bit, allowing models
+ * to track uninitialized and unknown bits or to resolve buses with several
+ * drivers.
+ */
+
+#ifndef STDULOGICVECTOR_H_
+#define STDULOGICVECTOR_H_
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <gmp.h>
+
+#include "StdLogicVector.h"
+#include "StdLogicVectorArray.h"
+
+using namespace std;
+
+/**
+ * @class StdULogicVector
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A nine-valued std_ulogic_vector as defined by IEEE 1164
+ * @version 0.1
+ *
+ * The nine values of each bit are encoded in four bit planes, each plane
+ * holding one bit per value bit (i.e., 64 values per limb and plane):
+ *
+ * <pre>
+ *   bit      | 0 1 L H X W U Z -
+ *   ---------+------------------
+ *   value    | 0 1 0 1 0 0 0 0 1
+ *   unknown  | 0 0 0 0 1 1 1 1 1
+ *   weak     | 0 0 1 1 0 1 0 1 0
+ *   special  | 0 0 0 0 0 0 1 1 0
+ * </pre>
+ *
+ * Thus, the IEEE 1164 tables of the logical operators and of the resolution
+ * function reduce to a handful of bitwise operations on the planes, which
+ * evaluate 64 bits per limb (or 512 bits per AVX-512 register, see
+ * ActiveULogicKernels()). Since the bits of a StdULogicVector reaching
+ * beyond its length are always @c 0, a vector of length @c n mirrors the VHDL
+ * type @c std_ulogic_vector(n-1 @c downto @c 0).
+ *
+ * Operations taking another StdULogicVector as operand expect it to have the
+ * same length (as required by VHDL). Otherwise, the vector is left unchanged.
+ */
+class StdULogicVector {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+  // The four planes (value, unknown, weak and special) are the elements of
+  // the array, each padded to a multiple of kULogicBlockLimbs limbs.
+  StdLogicVectorArray planes_;
+  int length_;
+
+  enum Plane { kValue, kUnknown, kWeak, kSpecial };
+
+  mp_limb_t * getPlane(Plane _plane);
+  const mp_limb_t * getPlane(Plane _plane) const;
+  void MaskToLength();
+
+public:
+  // **************************************************************************
+  // Constructors
+  // **************************************************************************
+  StdULogicVector();
+  StdULogicVector(int _length);
+  StdULogicVector(int _length, char _value);
+  StdULogicVector(string_view _value);
+  StdULogicVector(const StdLogicVector & _value);
+
+
+  // **************************************************************************
+  // Getter/Setter functions
+  // **************************************************************************
+  int getLength() const;
+  char getBit(int _index) const;
+  void setBit(int _index, char _value);
+
+
+  // **************************************************************************
+  // Utility functions
+  // **************************************************************************
+  bool IsX() const;
+  string ToString() const;
+  StdLogicVector ToStdLogicVector() const;
+
+
+  // **************************************************************************
+  // Operator overloadings
+  // **************************************************************************
+  bool operator==(const StdULogicVector & _input) const;
+  bool operator!=(const StdULogicVector & _input) const;
+  friend ostream & operator<<(ostream & _os, const StdULogicVector & _vec);
+
+
+  // **************************************************************************
+  // Logical operations
+  // **************************************************************************
+  StdULogicVector & And(const StdULogicVector & _operand);
+  StdULogicVector & Or(const StdULogicVector & _operand);
+  StdULogicVector & Xor(const StdULogicVector & _operand);
+  StdULogicVector & Not();
+  StdULogicVector & Resolve(const StdULogicVector & _driver);
+};
+
+#endif /* STDULOGICVECTOR_H_ */
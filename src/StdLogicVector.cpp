@@ -40,13 +40,297 @@
 #include <string>
 #include <gmp.h>
 #include <gmpxx.h>
-#include <math.h>
 #include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 #include "StdLogicVector.h"
+#include "StdLogicVectorView.h"
+#include "StdLogicVectorKernels.h"
 
 using namespace std;
 
+
+// ****************************************************************************
+// Kernels
+// ****************************************************************************
+// Digits used when formatting values in bases up to 36.
+static const char kDigitsLower[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+static const char kDigitsUpper[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// Number of digits per bit (i.e., 1 / log2(base)) of each base as a 0.64
+// fixed-point number, rounded up. Powers of two are handled separately.
+static const uint64_t kDigitsPerBit[63] = {
+  0, 0, 0,
+  0xA1849CC1A9A9E94FULL, 0, 0x6E40D1A4143DCB95ULL,
+  0x6308C91B702A7CF5ULL, 0x5B3064EB3AA6D389ULL, 0,
+  0x50C24E60D4D4F4A8ULL, 0x4D104D427DE7FBCDULL, 0x4A00270775914E89ULL,
+  0x4768CE0D05818E13ULL, 0x452E53E365907BDBULL, 0x433CFFFB4B5AAE56ULL,
+  0x41867711B4F85356ULL, 0, 0x3EA16AFD58B10967ULL,
+  0x3D64598D154DC4DFULL, 0x3C43C23018BB5564ULL, 0x3B3B9A42873069C8ULL,
+  0x3A4898F06CF41ACAULL, 0x39680B13582E7C19ULL, 0x3897B2B751AE561BULL,
+  0x37D5AED131F19C99ULL, 0x372068D20A1EE5CBULL, 0x3676867E5D60DE2AULL,
+  0x35D6DEEB388DF870ULL, 0x354071D61C77FA2FULL, 0x34B260C5671B18ADULL,
+  0x342BE986572B45CDULL, 0x33AC61B998FBBDF3ULL, 0,
+  0x32BFD90114C12862ULL, 0x3251DCF6169E45F3ULL, 0x31E8D59F180DC631ULL,
+  0x3184648DB8153E7BULL, 0x312434E89C35DACEULL, 0x30C7FA349460A542ULL,
+  0x306F6F4C8432BC6EULL, 0x301A557FFBFDD253ULL, 0x2FC873D1FDA55F3CULL,
+  0x2F799652A4E6DC4AULL, 0x2F2D8D8F64460AAEULL, 0x2EE42E164E8F53A5ULL,
+  0x2E9D500984041DBEULL, 0x2E58CEC05A6A8145ULL, 0x2E1688743EF9104DULL,
+  0x2DD65DF7A5835990ULL, 0x2D9832759D5369C5ULL, 0x2D5BEB38DCD1394DULL,
+  0x2D216F7943E2BA6BULL, 0x2CE8A82EFBB3FF2DULL, 0x2CB17FEA7AD7E333ULL,
+  0x2C7BE2B0CFA1BA51ULL, 0x2C47BDDBA92D7464ULL, 0x2C14FFFCAA8B131FULL,
+  0x2BE398C3A38BE054ULL, 0x2BB378E758451069ULL, 0x2B8492108BE5E5F8ULL,
+  0x2B56D6C70D55481CULL, 0x2B2A3A608C72DDD6ULL, 0x2AFEB0F1060C7E42ULL
+};
+
+/**
+ * @brief Determines the number of digits required to represent any value of
+ *   @p _length bits in base @p _base (2 to 62), using integer arithmetic only.
+ */
+static size_t PadDigits(int _length, int _base) {
+  uint64_t length = max(_length, 0);
+  uint64_t hi     = kDigitsPerBit[_base] >> 32;
+  uint64_t lo     = kDigitsPerBit[_base] & 0xFFFFFFFF;
+
+  if ( (_base & (_base - 1)) == 0 ) {
+    unsigned int bits = __builtin_ctz(_base);
+    return (length + bits - 1) / bits;
+  }
+  if ( length == 0 ) {
+    return 0;
+  }
+  // The integral part of length * kDigitsPerBit[_base] / 2^64 plus one, as the
+  // product is never integral for bases other than powers of two.
+  return ((length * hi + ((length * lo) >> 32)) >> 32) + 1;
+}
+
+// Value of each character as a digit of a base up to 36 (99 if the character
+// is not a digit at all).
+static const unsigned char kDigitValue[256] = {
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 99, 99, 99, 99, 99, 99,
+  99, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 99, 99, 99, 99, 99,
+  99, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99
+};
+
+/**
+ * @brief Determines the value of a single digit in the given base, following
+ *   the conventions of GMP (letters are case-insensitive up to base 36, while
+ *   upper-case letters precede lower-case ones for larger bases).
+ * @return The value of the digit, or -1 if it is not a digit of @p _base.
+ */
+static inline int DigitValue(char _char, int _base) {
+  int digit = kDigitValue[static_cast<unsigned char>(_char)];
+
+  if ( _base > 36 && _char >= 'a' && _char <= 'z' ) {
+    digit += 26;
+  }
+  return (digit < _base) ? digit : -1;
+}
+
+// Up to this number of limbs, shifts and bitwise operations use plain loops,
+// which are faster than calling into GMP or dispatching to a kernel.
+static const mp_size_t kLoopLimbs = 8;
+
+// Scratch limbs of the multiplication of wide values, kept by each thread such
+// that they are only allocated when growing.
+static thread_local vector<mp_limb_t> tMulScratch;
+
+/**
+ * @brief Shifts @p _n limbs (at least one) to the left by 1 to
+ *   GMP_NUMB_BITS - 1 bits like mpn_lshift(), but without the call overhead
+ *   dominating narrow values. @p _dst may be at or above @p _src.
+ * @return The bits shifted out of the most significant limb.
+ */
+static inline mp_limb_t ShiftLimbsLeft(mp_limb_t * _dst,
+    const mp_limb_t * _src, mp_size_t _n, unsigned int _shift) {
+  mp_limb_t carry = _src[_n - 1] >> (GMP_NUMB_BITS - _shift);
+
+  for (mp_size_t i = _n - 1; i > 0; --i) {
+    _dst[i] = (_src[i] << _shift) | (_src[i - 1] >> (GMP_NUMB_BITS - _shift));
+  }
+  _dst[0] = _src[0] << _shift;
+  return carry;
+}
+
+/**
+ * @brief Shifts @p _n limbs (at least one) to the right by 1 to
+ *   GMP_NUMB_BITS - 1 bits like mpn_rshift(). @p _dst may be at or below
+ *   @p _src.
+ */
+static inline void ShiftLimbsRight(mp_limb_t * _dst, const mp_limb_t * _src,
+    mp_size_t _n, unsigned int _shift) {
+  for (mp_size_t i = 0; i < _n - 1; ++i) {
+    _dst[i] = (_src[i] >> _shift) | (_src[i + 1] << (GMP_NUMB_BITS - _shift));
+  }
+  _dst[_n - 1] = _src[_n - 1] >> _shift;
+}
+
+/**
+ * @brief Clears the bits of the most significant limb of a value of @p _width
+ *   bits (at least one) beyond that width.
+ */
+static inline void MaskTopLimb(mp_limb_t * _limbs, int _width) {
+  unsigned int rem = _width % GMP_NUMB_BITS;
+
+  if ( rem != 0 ) {
+    _limbs[(_width - 1) / GMP_NUMB_BITS] &=
+        (static_cast<mp_limb_t>(1) << rem) - 1;
+  }
+}
+
+/**
+ * @brief Replaces the bits of a limb from @p _width on with zeros (unsigned)
+ *   or with copies of bit @p _width - 1 (signed).
+ */
+static inline mp_limb_t ExtendLimb(mp_limb_t _limb, int _width,
+    bool _signed) {
+  mp_limb_t keep;
+
+  if ( _width >= GMP_NUMB_BITS ) {
+    return _limb;
+  }
+  keep = (static_cast<mp_limb_t>(1) << _width) - 1;
+  if ( _signed && _width > 0 && ((_limb >> (_width - 1)) & 1) != 0 ) {
+    return _limb | ~keep;
+  }
+  return _limb & keep;
+}
+
+/**
+ * @brief Returns the degree of a polynomial over GF(2) (i.e., the index of the
+ *   most significant bit set), or -1 for the zero polynomial.
+ */
+static inline long PolyDegree(const mp_limb_t * _limbs, mp_size_t _size) {
+  while ( _size > 0 && _limbs[_size - 1] == 0 ) {
+    _size--;
+  }
+  if ( _size == 0 ) {
+    return -1;
+  }
+  return static_cast<long>(_size) * GMP_NUMB_BITS - 1 -
+      (__builtin_clzll(_limbs[_size - 1]) - (64 - GMP_NUMB_BITS));
+}
+
+/**
+ * @brief Adds (i.e., XORs) a polynomial multiplied by x^@p _shift to another
+ *   one, dropping the terms beyond the @p _dstSize limbs of the destination.
+ */
+static void XorShiftedLimbs(mp_limb_t * _dst, mp_size_t _dstSize,
+    const mp_limb_t * _src, mp_size_t _srcSize, unsigned long _shift) {
+  mp_size_t offset = _shift / GMP_NUMB_BITS;
+  unsigned int bits = _shift % GMP_NUMB_BITS;
+
+  _srcSize = min(_srcSize, _dstSize - offset);
+  if ( bits == 0 ) {
+    for (mp_size_t i = 0; i < _srcSize; ++i) {
+      _dst[offset + i] ^= _src[i];
+    }
+    return;
+  }
+  for (mp_size_t i = 0; i < _srcSize; ++i) {
+    _dst[offset + i] ^= _src[i] << bits;
+    if ( offset + i + 1 < _dstSize ) {
+      _dst[offset + i + 1] ^= _src[i] >> (GMP_NUMB_BITS - bits);
+    }
+  }
+}
+
+/**
+ * @brief Reduces a polynomial over GF(2) modulo a polynomial of degree @p _m
+ *   (at least one) in place.
+ *
+ * Sparse moduli (e.g., the trinomials and pentanomials of the standards) are
+ * reduced by folding all terms of degree @p _m and above onto the lower ones
+ * at once, which takes two or three passes. Other moduli are reduced by a
+ * bit-serial long division.
+ *
+ * @param _p The polynomial to be reduced. Its @p _size limbs are modified,
+ *   but only those holding the @p _m least significant bits are non-zero
+ *   afterwards.
+ * @param _f The modulus, in LimbsForWidth(@p _m + 1) limbs.
+ * @param _scratch Scratch of @p _size limbs.
+ */
+static void ReducePolyLimbs(mp_limb_t * _p, mp_size_t _size,
+    const mp_limb_t * _f, long _m, mp_limb_t * _scratch) {
+  mp_size_t fSize = _m / GMP_NUMB_BITS + 1;
+  mp_size_t mSize = (_m + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+  unsigned int mBits = _m % GMP_NUMB_BITS;
+  long degree = PolyDegree(_p, _size);
+  long lower = -1;
+  int terms = 0;
+
+  // Degree and number of the terms of the modulus below x^m.
+  for (mp_size_t i = 0; i < fSize; ++i) {
+    mp_limb_t limb = _f[i];
+
+    if ( i == fSize - 1 ) {
+      limb &= ~(static_cast<mp_limb_t>(1) << mBits);
+    }
+    if ( limb != 0 ) {
+      lower  = i * GMP_NUMB_BITS + PolyDegree(&limb, 1);
+      terms += __builtin_popcountll(limb);
+    }
+  }
+
+  if ( degree < _m ) {
+    return;
+  }
+  if ( 2 * lower > _m || terms > 8 ) {
+    for (long bit = degree; bit >= _m; --bit) {
+      if ( (_p[bit / GMP_NUMB_BITS] >> (bit % GMP_NUMB_BITS)) & 1 ) {
+        XorShiftedLimbs(_p, _size, _f, fSize, bit - _m);
+      }
+    }
+    return;
+  }
+
+  while ( degree >= _m ) {
+    mp_size_t high = (degree - _m) / GMP_NUMB_BITS + 1;
+    mp_size_t from = _m / GMP_NUMB_BITS;
+
+    // Split off the terms of degree m and above (divided by x^m).
+    if ( mBits == 0 ) {
+      mpn_copyi(_scratch, _p + from, high);
+    } else {
+      mpn_rshift(_scratch, _p + from, min(high + 1, _size - from), mBits);
+    }
+    mpn_zero(_p + mSize, _size - mSize);
+    if ( mBits != 0 ) {
+      _p[mSize - 1] &= (static_cast<mp_limb_t>(1) << mBits) - 1;
+    }
+
+    // Over GF(2), x^m = f - x^m is the sum of the lower terms of f.
+    for (mp_size_t i = 0; i < fSize; ++i) {
+      mp_limb_t limb = _f[i];
+
+      if ( i == fSize - 1 ) {
+        limb &= ~(static_cast<mp_limb_t>(1) << mBits);
+      }
+      while ( limb != 0 ) {
+        XorShiftedLimbs(_p, _size, _scratch, high,
+            i * GMP_NUMB_BITS + __builtin_ctzll(limb));
+        limb &= limb - 1;
+      }
+    }
+    degree = PolyDegree(_p, _size);
+  }
+}
+
 // ****************************************************************************
 // Constructors/Destructors
 // ****************************************************************************
@@ -54,8 +338,9 @@ using namespace std;
  * @brief The default constructor creates a new StdLogicVector of length
  *   zero and initializes its value to zero.
  */
-StdLogicVector::StdLogicVector() : length_(0), isDontCare_(false) {
-  mpz_init(value_);
+StdLogicVector::StdLogicVector() : length_(0), isDontCare_(false),
+    isWrapping_(false) {
+  InitInline();
 }
 
 /**
@@ -63,9 +348,10 @@ StdLogicVector::StdLogicVector() : length_(0), isDontCare_(false) {
  *   to zero.
  * @param _length The length of the StdLogicVector in bits.
  */
-StdLogicVector::StdLogicVector(unsigned int _length) : isDontCare_(false)
+StdLogicVector::StdLogicVector(unsigned int _length) : isDontCare_(false),
+    isWrapping_(false)
 {
-  mpz_init(value_);
+  InitInline();
   length_ = _length;
 }
 
@@ -78,15 +364,17 @@ StdLogicVector::StdLogicVector(unsigned int _length) : isDontCare_(false)
  * @todo Check whether the bits are enough to represent the provided value.
  */
 StdLogicVector::StdLogicVector(unsigned long long _value, unsigned int _length) :
-		isDontCare_(false)
+		isDontCare_(false), isWrapping_(false)
 {
-  mpz_init(value_);
-  // First version to initialize a GMP variable from unsigned long long.
-  mpz_import(value_, 1, -1, sizeof(_value), 0, 0, &_value);
-  // Second version to initialize a GMP variable from unsigned long long.
-//  mpz_set_ui(value, (unsigned int)(_value >> 32));
-//  mpz_mul_2exp(value, value, 32);
-//  mpz_add_ui(value, value, (unsigned int)_value);
+  InitInline();
+  // An unsigned long long always fits into the inline limbs.
+  inline_[0] = static_cast<mp_limb_t>(_value);
+#if GMP_NUMB_BITS < 64
+  inline_[1] = static_cast<mp_limb_t>(_value >> GMP_NUMB_BITS);
+  FinishLimbs(2);
+#else
+  FinishLimbs(1);
+#endif
   length_ = _length;
 }
 
@@ -104,24 +392,33 @@ StdLogicVector::StdLogicVector(unsigned long long _value, unsigned int _length)
  * @param _length The length of the StdLogicVector in bits.
  * @todo Check whether the bits are enough to represent the provided value.
  */
-StdLogicVector::StdLogicVector(string _value, int _base, unsigned int _length) :
-		isDontCare_(false)
+StdLogicVector::StdLogicVector(string_view _value, int _base,
+		unsigned int _length) : isDontCare_(false), isWrapping_(false)
 {
-  mpz_init_set_str(value_, _value.c_str(), _base);
+  InitInline();
+
+  // Anything the strict parser rejects (e.g., whitespace or a base of 0) is
+  // still accepted by GMP.
+  if ( SetDigits(_value.data(), _value.data() + _value.size(), _base).ec !=
+       errc() ) {
+    mpz_t tmp;
+
+    mpz_init_set_str(tmp, string(_value).c_str(), _base);
+    SetValue(tmp);
+    mpz_clear(tmp);
+  }
   length_ = _length;
 }
 
 /**
- * @copydoc StdLogicVector::StdLogicVector(string, int, unsigned int)
+ * @copydoc StdLogicVector::StdLogicVector(string_view, int, unsigned int)
  * @param _isDontCare Determines whether the value of the created StdLogicVector
  *   should be marked as a don't care.
  */
-StdLogicVector::StdLogicVector(string _value, int _base, unsigned int _length,
-		bool _isDontCare)
+StdLogicVector::StdLogicVector(string_view _value, int _base,
+		unsigned int _length, bool _isDontCare) :
+		StdLogicVector(_value, _base, _length)
 {
-  mpz_init_set_str(value_, _value.c_str(), _base);
-
-  length_ 		= _length;
   isDontCare_ = _isDontCare;
 }
 
@@ -137,10 +434,10 @@ StdLogicVector::StdLogicVector(string _value, int _base, unsigned int _length,
  * @todo Check whether the bits are enough to represent the provided value.
  */
 StdLogicVector::StdLogicVector(unsigned char *_value, int _bytes,
-     unsigned int _length) : isDontCare_(false)
+     unsigned int _length) : isDontCare_(false), isWrapping_(false)
 {
-	mpz_init(value_);
-  mpz_import(value_, _bytes, 1, sizeof(_value[0]), 1, 0, _value);
+  InitInline();
+  ImportWords(_value, max(_bytes, 0), kBigEndian);
   length_ = _length;
 }
 
@@ -153,13 +450,90 @@ StdLogicVector::StdLogicVector (const StdLogicVector & _other)
 {
 	length_ 		= _other.getLength();
 	isDontCare_	= _other.isDontCare();
-	mpz_init_set(value_, _other.getValue());
+	isWrapping_	= _other.isWrapping();
+	InitInline();
+	SetValue(_other.getValue());
+}
+
+/**
+ * @brief Copy-assignment. Copies both the @a length_ and the @a value_ of
+ *   another StdLogicVector, reusing the storage already owned by @c this.
+ *
+ * An explicit assignment is required since an inline value is referenced from
+ * within the object itself and must therefore never be copied member-wise.
+ *
+ * @param _other The StdLogicVector to be copied.
+ * @return The StdLogicVector holding a copy of @p _other.
+ */
+StdLogicVector & StdLogicVector::operator=(const StdLogicVector & _other)
+{
+	if ( this != &_other ) {
+		length_ 		= _other.getLength();
+		isDontCare_	= _other.isDontCare();
+		isWrapping_	= _other.isWrapping();
+		SetValue(_other.getValue());
+	}
+	return *this;
+}
+
+/**
+ * @brief Move-constructor. Takes over the storage of another StdLogicVector
+ *   without copying its limbs (unless they are kept inline).
+ * @param _other The StdLogicVector to be moved. It is left with a valid but
+ *   unspecified value.
+ */
+StdLogicVector::StdLogicVector (StdLogicVector && _other) noexcept
+{
+	length_ 		= _other.getLength();
+	isDontCare_	= _other.isDontCare();
+	isWrapping_	= _other.isWrapping();
+	if ( _other.IsInline() ) {
+		InitInline();
+		SetValue(_other.getValue());
+	} else {
+		*value_ = *_other.value_;
+		_other.InitInline();
+	}
+}
+
+/**
+ * @brief Move-assignment. Takes over the storage of another StdLogicVector
+ *   without copying its limbs (unless they are kept inline).
+ *
+ * If both StdLogicVectors hold GMP-managed storage, the storage is exchanged,
+ * such that the storage previously owned by @c this is released by
+ * @p _other.
+ *
+ * @param _other The StdLogicVector to be moved.
+ * @return The StdLogicVector holding the value of @p _other.
+ */
+StdLogicVector & StdLogicVector::operator=(StdLogicVector && _other) noexcept
+{
+	if ( this != &_other ) {
+		length_ 		= _other.getLength();
+		isDontCare_	= _other.isDontCare();
+		isWrapping_	= _other.isWrapping();
+		if ( _other.IsInline() ) {
+			// Never allocates, since GMP-managed storage is always larger than the
+			// inline limbs.
+			SetValue(_other.getValue());
+		} else if ( IsInline() ) {
+			*value_ = *_other.value_;
+			_other.InitInline();
+		} else {
+			mpz_swap(value_, _other.value_);
+		}
+	}
+	return *this;
 }
 
 /**
- * @brief Destructor
+ * @brief Destructor. Releases the GMP-managed storage (if any).
  */
 StdLogicVector::~StdLogicVector() {
+	if ( !IsInline() ) {
+		mpz_clear(value_);
+	}
 }
 
 
@@ -193,6 +567,34 @@ bool StdLogicVector::isDontCare() const {
 	return isDontCare_;
 }
 
+/**
+ * @brief Returns a boolean determining whether the StdLogicVector wraps around
+ *   at its @a length_ (i.e., whether it uses modular arithmetic).
+ * @return Value determining whether the StdLogicVector wraps around.
+ */
+bool StdLogicVector::isWrapping() const {
+	return isWrapping_;
+}
+
+/**
+ * @brief Enables or disables the wrap-around mode of the StdLogicVector.
+ *
+ * Per default, some operations may grow the value of a StdLogicVector beyond
+ * its @a length_ (e.g., ShiftLeft() or Or() with a longer operand). In
+ * wrap-around mode, all operations keep the value within @a length_ bits,
+ * i.e., they work modulo 2^length_, without creating any temporary objects.
+ *
+ * @param _isWrapping Determines whether the StdLogicVector should wrap around
+ *   at its @a length_. When enabled, bits beyond @a length_ are cleared
+ *   immediately.
+ */
+void StdLogicVector::setWrapping(bool _isWrapping) {
+	isWrapping_ = _isWrapping;
+	if ( isWrapping_ ) {
+		MaskToWidth(length_);
+	}
+}
+
 
 // **************************************************************************
 // Operator Overloadings
@@ -225,13 +627,56 @@ bool StdLogicVector::operator!=(const StdLogicVector & _input) const {
 	return !(*this == _input);
 }
 
+/**
+ * @brief Compares the StdLogicVector with an expected value, ignoring all
+ *   bits which are not set in a care mask (i.e., the VHDL @c std_match with
+ *   @c - in the expected value).
+ * @param _expected The expected value.
+ * @param _care The care mask, holding a 1 for each bit to be compared.
+ * @return True if both StdLogicVectors have the same length and agree in all
+ *   bits set in @p _care. Otherwise false.
+ */
+bool StdLogicVector::MatchesWithMask(const StdLogicVector & _expected,
+		const StdLogicVector & _care) const {
+	mp_size_t size      = mpz_size(value_);
+	mp_size_t expSize   = mpz_size(_expected.getValue());
+	mp_size_t careSize  = mpz_size(_care.getValue());
+	mp_size_t common    = min(min(size, expSize), careSize);
+	mp_size_t total     = min(max(size, expSize), careSize);
+
+	if ( length_ != _expected.getLength() ) {
+		return false;
+	}
+	if ( common > 0 && ActiveBitwiseKernels().FindMismatch(
+			mpz_limbs_read(value_), mpz_limbs_read(_expected.getValue()),
+			mpz_limbs_read(_care.getValue()), common) != common ) {
+		return false;
+	}
+	// Limbs present in only one of both values.
+	for (mp_size_t i = common; i < total; ++i) {
+		if ( ((mpz_getlimbn(value_, i) ^ mpz_getlimbn(_expected.getValue(), i)) &
+				mpz_getlimbn(_care.getValue(), i)) != 0 ) {
+			return false;
+		}
+	}
+	return true;
+}
+
 /**
  * @brief Provide a nice stream output showing the value of the StdLogicVector
  *   in hexadecimal representation and also its length.
  */
 ostream & operator<<(ostream & _os, const StdLogicVector & _stdLogicVec)
 {
-    _os << _stdLogicVec.ToString(16, true) << "(" << _stdLogicVec.getLength() << "bits)";
+    char buf[256];
+
+    // Only values exceeding the local buffer take the detour via a string.
+    if ( _stdLogicVec.FormatTo(buf, sizeof(buf), 16, true) > 0 ) {
+      _os << buf;
+    } else {
+      _os << _stdLogicVec.ToString(16, true);
+    }
+    _os << "(" << _stdLogicVec.getLength() << "bits)";
     return _os;
 }
 
@@ -252,6 +697,99 @@ int StdLogicVector::TestBit(int _index) const {
   return mpz_tstbit(value_, _index);
 }
 
+/**
+ * @brief Counts the bits set within the @a length_ of the StdLogicVector.
+ * @return The number of bits set.
+ */
+int StdLogicVector::PopCount() const {
+  vector<mp_limb_t> scratch;
+  mp_size_t size;
+  const mp_limb_t * limbs = ReadLimbsWithinLength(size, scratch);
+
+  return static_cast<int>(ActivePopCountKernels().PopCount(limbs, NULL, size));
+}
+
+/**
+ * @brief Determines the parity of the StdLogicVector (i.e., the XOR of all of
+ *   its bits).
+ * @retval 0 If an even number of bits is set.
+ * @retval 1 If an odd number of bits is set.
+ */
+int StdLogicVector::Parity() const {
+  return PopCount() & 1;
+}
+
+/**
+ * @brief Counts the zero bits above the most significant bit set, relative to
+ *   the @a length_ of the StdLogicVector.
+ * @return The number of leading zeros (@a length_ if no bit is set).
+ */
+int StdLogicVector::CountLeadingZeros() const {
+  vector<mp_limb_t> scratch;
+  mp_size_t size;
+  const mp_limb_t * limbs = ReadLimbsWithinLength(size, scratch);
+
+  for (mp_size_t i = size - 1; i >= 0; --i) {
+    if ( limbs[i] != 0 ) {
+      int highest = static_cast<int>(i * GMP_NUMB_BITS) + GMP_NUMB_BITS - 1 -
+          (__builtin_clzll(limbs[i]) - (64 - GMP_NUMB_BITS));
+      return length_ - 1 - highest;
+    }
+  }
+  return length_;
+}
+
+/**
+ * @brief Counts the zero bits below the least significant bit set.
+ * @return The number of trailing zeros (@a length_ if no bit is set).
+ */
+int StdLogicVector::CountTrailingZeros() const {
+  vector<mp_limb_t> scratch;
+  mp_size_t size;
+  const mp_limb_t * limbs = ReadLimbsWithinLength(size, scratch);
+
+  for (mp_size_t i = 0; i < size; ++i) {
+    if ( limbs[i] != 0 ) {
+      return static_cast<int>(i * GMP_NUMB_BITS) + __builtin_ctzll(limbs[i]);
+    }
+  }
+  return length_;
+}
+
+/**
+ * @brief Finds the least significant bit set (like the POSIX @c ffs()).
+ * @return The 1-based index of the least significant bit set, or 0 if no bit
+ *   is set.
+ */
+int StdLogicVector::FindFirstSet() const {
+  int zeros = CountTrailingZeros();
+
+  return (zeros == length_) ? 0 : zeros + 1;
+}
+
+/**
+ * @brief Counts the bits in which two StdLogicVectors differ. Bits beyond the
+ *   length of either StdLogicVector count as zero.
+ * @param _operand The StdLogicVector to compare with.
+ * @return The Hamming distance of the two StdLogicVectors.
+ */
+int StdLogicVector::HammingDistance(const StdLogicVector & _operand) const {
+  const PopCountKernels & kernels = ActivePopCountKernels();
+  vector<mp_limb_t> scratchA, scratchB;
+  mp_size_t sizeA, sizeB;
+  const mp_limb_t * a = ReadLimbsWithinLength(sizeA, scratchA);
+  const mp_limb_t * b = _operand.ReadLimbsWithinLength(sizeB, scratchB);
+  mp_bitcnt_t count;
+
+  if ( sizeA < sizeB ) {
+    swap(a, b);
+    swap(sizeA, sizeB);
+  }
+  count = kernels.PopCount(a, b, sizeB) +
+      kernels.PopCount(a + sizeB, NULL, sizeA - sizeB);
+  return static_cast<int>(count);
+}
+
 
 /**
  * @brief Converts the value of the current StdLogicVector into an unsigned
@@ -276,19 +814,15 @@ unsigned long long StdLogicVector::ToULL() {
  *   than what fits into an unsigned long long (usually 64bits).
  */
 unsigned long long StdLogicVector::ToULL() const {
-  unsigned int lowerWord, higherWord;
-  mpz_t tmp;
+  const mp_limb_t * limbs = mpz_limbs_read(value_);
+  mp_size_t size = mpz_size(value_);
+  unsigned long long result = 0;
 
-  mpz_init( tmp );
-  mpz_mod_2exp( tmp, value_, 64 );
-
-  lowerWord = mpz_get_ui( tmp );
-  mpz_div_2exp( tmp, tmp, 32 );
-  higherWord = mpz_get_ui( tmp );
-
-  mpz_clear( tmp );
-
-  return (((unsigned long long)higherWord) << 32) + lowerWord;
+  // The least significant 64 bits, read from the limbs directly.
+  for (mp_size_t i = 0; i < size && i * GMP_NUMB_BITS < 64; ++i) {
+    result |= static_cast<unsigned long long>(limbs[i]) << (i * GMP_NUMB_BITS);
+  }
+  return result;
 }
 
 /**
@@ -355,21 +889,149 @@ string StdLogicVector::ToString(int _base, bool _pad) {
  * @return The value of the StdLogicVector in the provided base representation.
  */
 string StdLogicVector::ToString(int _base, bool _pad) const {
+  string strValue(FormatLength(_base, _pad), '\0');
+  to_chars_result result = ToChars(&strValue[0],
+      &strValue[0] + strValue.size(), _base, _pad);
 
-  double baseLength;
-  string strValue;
-  string strTmp = mpz_get_str(NULL, _base, value_);
+  strValue.resize(result.ec == errc() ? result.ptr - &strValue[0] : 0);
+  return strValue;
+}
 
-  // Determine size of the value (i.e., length of string) for the given base.
-  baseLength = ceil(length_ / (log(_base)/log(2)));
+/**
+ * @brief Determines the maximum number of characters FormatTo() and ToChars()
+ *   produce for the current value of the StdLogicVector.
+ * @param _base The base in which the number should be represented.
+ * @param _pad Determines whether the value is padded using leading zeros.
+ * @return The maximum number of characters (excluding a terminating null
+ *   character), or 0 if @p _base is not supported.
+ */
+size_t StdLogicVector::FormatLength(int _base, bool _pad) const {
+  int base = abs(_base);
 
-  // Apply padding if required.
-  if (strTmp.length() < baseLength && _pad) {
-    strValue.append(baseLength-strTmp.length(), '0');
+  if ( base < 2 || base > 62 || _base < -36 ) {
+    return 0;
   }
-  strValue.append(strTmp);
+  return max(mpz_sizeinbase(value_, base), _pad ? PadDigits(length_, base) :
+      0);
+}
 
-  return strValue;
+/**
+ * @brief Writes the value of the StdLogicVector into a character range, in
+ *   the manner of @c std::to_chars (i.e., without a terminating null
+ *   character and without allocating memory).
+ *
+ * Bases being a power of two are formatted by extracting the digits directly
+ * from the limbs. All other bases are converted by GMP, which requires a
+ * scratch buffer on the heap for (decimal) values of more than about 400 bits.
+ *
+ * @param _first The beginning of the character range.
+ * @param _last The end of the character range.
+ * @param _base The base in which the number should be represented (2 to 62,
+ *   or -2 to -36 for upper-case digits).
+ * @param _pad Determines whether to pad the value using leading zeros (as many
+ *   as determined by the length of the StdLogicVector).
+ * @return The end of the written characters and a default error code on
+ *   success. Otherwise @p _last and either errc::value_too_large or
+ *   errc::invalid_argument.
+ */
+to_chars_result StdLogicVector::ToChars(char * _first, char * _last,
+    int _base, bool _pad) const {
+  const char * digits = (_base < 0) ? kDigitsUpper : kDigitsLower;
+  const mp_limb_t * limbs = mpz_limbs_read(value_);
+  mp_size_t size = mpz_size(value_);
+  int base = abs(_base);
+  size_t count;
+  char * pos;
+
+  if ( base < 2 || base > 62 || _base < -36 ) {
+    return { _last, errc::invalid_argument };
+  }
+  count = _pad ? PadDigits(length_, base) : 0;
+
+  // Bases being a power of two: extract the digits directly from the limbs.
+  if ( (base & (base - 1)) == 0 && base <= 32 ) {
+    unsigned int bits = __builtin_ctz(base);
+    mp_limb_t mask    = base - 1;
+
+    count = max<size_t>(count, (mpz_sizeinbase(value_, 2) + bits - 1) / bits);
+    if ( static_cast<size_t>(_last - _first) < count ) {
+      return { _last, errc::value_too_large };
+    }
+
+    pos = _first + count;
+    if ( GMP_NUMB_BITS % bits == 0 ) {
+      size_t perLimb = GMP_NUMB_BITS / bits;
+
+      mp_size_t i = 0;
+
+      // Whole limbs of hexadecimal digits at once.
+      if ( bits == 4 ) {
+        i    = min<mp_size_t>((pos - _first) / perLimb, size);
+        pos -= i * perLimb;
+        ActiveShuffleKernels().FormatHex(pos, limbs, i, digits);
+      }
+      for (; pos > _first; ++i) {
+        mp_limb_t limb = (i < size) ? limbs[i] : 0;
+        char * end = pos - min<size_t>(perLimb, pos - _first);
+
+        while ( pos > end ) {
+          *--pos = digits[limb & mask];
+          limb >>= bits;
+        }
+      }
+    } else {
+      for (mp_bitcnt_t bit = 0; pos > _first; bit += bits) {
+        *--pos = digits[ReadLimb(limbs, size, bit) & mask];
+      }
+    }
+    return { _first + count, errc() };
+  }
+
+  // All other bases: let GMP convert the value into a scratch buffer (on the
+  // heap only for values exceeding the local one), then right-align it.
+  char local[128];
+  string scratch;
+  char * tmp = local;
+  size_t length;
+
+  if ( mpz_sizeinbase(value_, base) + 2 > sizeof(local) ) {
+    scratch.resize(mpz_sizeinbase(value_, base) + 2);
+    tmp = &scratch[0];
+  }
+  length = strlen(mpz_get_str(tmp, _base, value_));
+  count  = max(count, length);
+  if ( static_cast<size_t>(_last - _first) < count ) {
+    return { _last, errc::value_too_large };
+  }
+  memset(_first, '0', count - length);
+  memcpy(_first + count - length, tmp, length);
+  return { _first + count, errc() };
+}
+
+/**
+ * @brief Writes the value of the StdLogicVector as a null-terminated string
+ *   into a caller-provided buffer, without allocating memory.
+ * @param _buf The buffer to be written.
+ * @param _cap The capacity of @p _buf, including the terminating null
+ *   character (at most FormatLength() + 1 characters are required).
+ * @param _base The base in which the number should be represented.
+ * @param _pad Determines whether to pad the value using leading zeros.
+ * @return The number of characters written (excluding the terminating null
+ *   character), or 0 if @p _buf is too small or @p _base is not supported.
+ */
+size_t StdLogicVector::FormatTo(char * _buf, size_t _cap, int _base,
+    bool _pad) const {
+  to_chars_result result;
+
+  if ( _cap == 0 ) {
+    return 0;
+  }
+  result = ToChars(_buf, _buf + _cap - 1, _base, _pad);
+  if ( result.ec != errc() ) {
+    return 0;
+  }
+  *result.ptr = '\0';
+  return result.ptr - _buf;
 }
 
 /**
@@ -385,19 +1047,136 @@ string StdLogicVector::ToString(int _base, bool _pad) const {
 
 /**
  * @brief Fills the provided byte array with the respective bytes of the value
- *   of the StdLogicVector.
+ *   of the StdLogicVector, most significant byte first. If @a length_ is not a
+ *   multiple of 8, the value is right-aligned, i.e., the first byte holds the
+ *   remaining most significant bits (e.g., 0xABC of 12 bits yields
+ *   {0x0A, 0xBC}).
  * @param _byteArray The byte array to be filled with the byte values.
  */
 void StdLogicVector::ToByteArray(unsigned char _byteArray[]) const {
+  ToBytes(_byteArray, (length_ + 7) / 8, kBigEndian);
+}
+
+/**
+ * @brief Exports the value of the StdLogicVector into a byte array.
+ * @param _bytes The byte array to be filled.
+ * @param _size The size of @p _bytes. Exactly (@a length_ + 7) / 8 bytes are
+ *   written.
+ * @param _endian Whether the most (kBigEndian) or the least (kLittleEndian)
+ *   significant byte is written first.
+ * @return False if @p _bytes is too small to hold the value, true otherwise.
+ */
+bool StdLogicVector::ToBytes(uint8_t * _bytes, size_t _size, Endian _endian)
+    const {
+  return ExportWords(_bytes, _size, _endian);
+}
+
+/**
+ * @brief Exports the value of the StdLogicVector into an array of 32-bit
+ *   words.
+ * @param _words The word array to be filled.
+ * @param _count The number of words of @p _words. Exactly
+ *   (@a length_ + 31) / 32 words are written.
+ * @param _endian The order of the words (the words themselves are stored in
+ *   the native byte order).
+ * @return False if @p _words is too small to hold the value, true otherwise.
+ */
+bool StdLogicVector::ToWords(uint32_t * _words, size_t _count, Endian _endian)
+    const {
+  return ExportWords(_words, _count, _endian);
+}
 
-  string hexString = this->ToString(16, true);
-  int length       = hexString.length();
-  unsigned int n;
+/**
+ * @brief Exports the value of the StdLogicVector into an array of 64-bit
+ *   words.
+ * @see ToWords(uint32_t *, size_t, Endian) const
+ */
+bool StdLogicVector::ToWords(uint64_t * _words, size_t _count, Endian _endian)
+    const {
+  return ExportWords(_words, _count, _endian);
+}
 
-  for (int i = 0; i < length; i=i+2) {
-    sscanf(hexString.c_str() + i, "%2X", &n);
-    _byteArray[i/2] = (char)n;
+/**
+ * @brief Creates a StdLogicVector from a string of digits, in the manner of
+ *   @c std::from_chars (i.e., reporting invalid input instead of producing an
+ *   arbitrary value).
+ * @param _first The first character (i.e., the most significant digit).
+ * @param _last The end of the characters.
+ * @param _base The base of the digits (2 to 62). In contrast to the
+ *   constructors, neither whitespace nor signs are accepted.
+ * @param _length The length of the StdLogicVector in bits.
+ * @param _result The StdLogicVector to be assigned (parsing directly into its
+ *   storage). If the string cannot be parsed, its value is cleared.
+ * @return The end of the characters and a default error code on success.
+ *   Otherwise, errc::invalid_argument together with the first character not
+ *   being a digit, or errc::result_out_of_range if the value does not fit
+ *   into @p _length bits.
+ */
+from_chars_result StdLogicVector::FromChars(const char * _first,
+    const char * _last, int _base, unsigned int _length,
+    StdLogicVector & _result) {
+  from_chars_result result = _result.SetDigits(_first, _last, _base);
+
+  _result.length_     = _length;
+  _result.isDontCare_ = false;
+  _result.isWrapping_ = false;
+  if ( result.ec == errc() && mpz_sgn(_result.value_) != 0 &&
+       mpz_sizeinbase(_result.value_, 2) > _length ) {
+    _result.FinishLimbs(0);
+    return { result.ptr, errc::result_out_of_range };
   }
+  return result;
+}
+
+/**
+ * @brief Creates a StdLogicVector from a byte array.
+ * @param _bytes The bytes to be imported.
+ * @param _size The number of bytes of @p _bytes.
+ * @param _endian Whether the first byte is the most (kBigEndian) or the least
+ *   (kLittleEndian) significant one.
+ * @param _length The length of the new StdLogicVector. Bits of @p _bytes
+ *   beyond this length are dropped.
+ * @return The new StdLogicVector.
+ */
+StdLogicVector StdLogicVector::FromBytes(const uint8_t * _bytes, size_t _size,
+    Endian _endian, unsigned int _length) {
+  StdLogicVector result(_length);
+
+  result.ImportWords(_bytes, _size, _endian);
+  result.MaskToWidth(_length);
+  return result;
+}
+
+/**
+ * @brief Creates a StdLogicVector from an array of 32-bit words.
+ * @param _words The words to be imported (in the native byte order).
+ * @param _count The number of words of @p _words.
+ * @param _endian Whether the first word is the most (kBigEndian) or the least
+ *   (kLittleEndian) significant one.
+ * @param _length The length of the new StdLogicVector. Bits of @p _words
+ *   beyond this length are dropped.
+ * @return The new StdLogicVector.
+ */
+StdLogicVector StdLogicVector::FromWords(const uint32_t * _words,
+    size_t _count, Endian _endian, unsigned int _length) {
+  StdLogicVector result(_length);
+
+  result.ImportWords(_words, _count, _endian);
+  result.MaskToWidth(_length);
+  return result;
+}
+
+/**
+ * @brief Creates a StdLogicVector from an array of 64-bit words.
+ * @see FromWords(const uint32_t *, size_t, Endian, unsigned int)
+ */
+StdLogicVector StdLogicVector::FromWords(const uint64_t * _words,
+    size_t _count, Endian _endian, unsigned int _length) {
+  StdLogicVector result(_length);
+
+  result.ImportWords(_words, _count, _endian);
+  result.MaskToWidth(_length);
+  return result;
 }
 
 /**
@@ -407,7 +1186,54 @@ void StdLogicVector::ToByteArray(unsigned char _byteArray[]) const {
  *   bits.
  */
 StdLogicVector& StdLogicVector::ShiftLeft(int _bits) {
-  mpz_mul_2exp(value_, value_, _bits);
+  mp_size_t size       = mpz_size(value_);
+  mp_size_t limbShift  = _bits / GMP_NUMB_BITS;
+  unsigned int bitShift = _bits % GMP_NUMB_BITS;
+  mp_size_t maxSize    = LimbsForWidth(length_);
+  mp_size_t newSize;
+  mp_limb_t * limbs;
+
+  if ( size == 0 || _bits <= 0 ) {
+    return *this;
+  }
+
+  // When wrapping around, limbs shifted beyond the length are never computed.
+  if ( isWrapping_ ) {
+    if ( limbShift >= maxSize ) {
+      ModifyLimbs(size);
+      FinishLimbs(0);
+      return *this;
+    }
+    size = min(size, maxSize - limbShift);
+  }
+
+  // Only grow by an additional limb if bits are actually shifted out of the
+  // most significant limb.
+  newSize = size + limbShift;
+  if ( bitShift != 0 && (!isWrapping_ || newSize < maxSize) &&
+       (mpz_getlimbn(value_, size - 1) >> (GMP_NUMB_BITS - bitShift)) != 0 ) {
+    newSize++;
+  }
+
+  limbs = ModifyLimbs(newSize);
+  if ( bitShift != 0 ) {
+    mp_limb_t carry = (size <= kLoopLimbs) ?
+        ShiftLimbsLeft(limbs + limbShift, limbs, size, bitShift) :
+        mpn_lshift(limbs + limbShift, limbs, size, bitShift);
+    if ( newSize > size + limbShift ) {
+      limbs[size + limbShift] = carry;
+    }
+  } else {
+    mpn_copyd(limbs + limbShift, limbs, size);
+  }
+  if ( limbShift > 0 ) {
+    mpn_zero(limbs, limbShift);
+  }
+  FinishLimbs(newSize);
+  if ( isWrapping_ ) {
+    MaskToWidth(length_);
+  }
+
   return *this;
 }
 
@@ -418,17 +1244,140 @@ StdLogicVector& StdLogicVector::ShiftLeft(int _bits) {
  *   bits.
  */
 StdLogicVector& StdLogicVector::ShiftRight(int _bits) {
-  mpz_tdiv_q_2exp(value_, value_, _bits);
+  mp_size_t size       = mpz_size(value_);
+  mp_size_t limbShift  = _bits / GMP_NUMB_BITS;
+  unsigned int bitShift = _bits % GMP_NUMB_BITS;
+  mp_limb_t * limbs;
+
+  if ( size == 0 || _bits <= 0 ) {
+    return *this;
+  }
+
+  limbs = ModifyLimbs(size);
+  if ( limbShift >= size ) {
+    FinishLimbs(0);
+    return *this;
+  }
+
+  if ( bitShift != 0 ) {
+    if ( size - limbShift <= kLoopLimbs ) {
+      ShiftLimbsRight(limbs, limbs + limbShift, size - limbShift, bitShift);
+    } else {
+      mpn_rshift(limbs, limbs + limbShift, size - limbShift, bitShift);
+    }
+  } else {
+    mpn_copyi(limbs, limbs + limbShift, size - limbShift);
+  }
+  FinishLimbs(size - limbShift);
+
+  return *this;
+}
+
+/**
+ * @brief Rotate left operation within the @a length_ of the StdLogicVector
+ *   (i.e., the VHDL @c rotate_left). Bits shifted beyond bit @a length_ - 1
+ *   re-enter at bit 0.
+ * @param _bits Number of bits to be rotated to the left. Negative values
+ *   rotate to the right.
+ * @return The rotated StdLogicVector.
+ */
+StdLogicVector & StdLogicVector::RotateLeft(int _bits) {
+  mp_size_t size = LimbsForWidth(length_);
+  mp_limb_t local[kInlineLimbs];
+  vector<mp_limb_t> heap;
+  mp_limb_t * value;
+  mp_limb_t * limbs;
+  mp_size_t limbShift;
+  unsigned int bitShift;
+  int bits;
+
+  if ( length_ == 0 ) {
+    return *this;
+  }
+  bits = ((_bits % length_) + length_) % length_;
+
+  // A value of a single limb is rotated in place, which compiles to a rol
+  // instruction for 64-bit vectors.
+  if ( size == 1 ) {
+    mp_limb_t mask = ~static_cast<mp_limb_t>(0) >> (GMP_NUMB_BITS - length_);
+    mp_limb_t limb = mpz_getlimbn(value_, 0) & mask;
+
+    if ( bits != 0 ) {
+      limb = ((limb << bits) | (limb >> (length_ - bits))) & mask;
+    }
+    limbs = ModifyLimbs(1);
+    limbs[0] = limb;
+    FinishLimbs(1);
+    return *this;
+  }
+
+  // The bits wrapping around are taken from a copy of the value, which also
+  // drops any bits beyond the length.
+  value = (size <= kInlineLimbs) ? local : (heap.resize(size), heap.data());
+  ExtendLimbs(value, size, kUnsigned);
+  limbs = ModifyLimbs(size);
+
+  limbShift = bits / GMP_NUMB_BITS;
+  bitShift  = bits % GMP_NUMB_BITS;
+  if ( bitShift != 0 ) {
+    mpn_lshift(limbs + limbShift, value, size - limbShift, bitShift);
+  } else {
+    mpn_copyi(limbs + limbShift, value, size - limbShift);
+  }
+  mpn_zero(limbs, limbShift);
+  MaskTopLimb(limbs, length_);
+
+  // Funnel shift the upper bits of the value into the lower limbs.
+  if ( bits != 0 ) {
+    limbShift = (length_ - bits) / GMP_NUMB_BITS;
+    bitShift  = (length_ - bits) % GMP_NUMB_BITS;
+    for (mp_size_t i = 0; i + limbShift < size; ++i) {
+      mp_limb_t limb = value[i + limbShift] >> bitShift;
+
+      if ( bitShift != 0 && i + limbShift + 1 < size ) {
+        limb |= value[i + limbShift + 1] << (GMP_NUMB_BITS - bitShift);
+      }
+      limbs[i] |= limb;
+    }
+  }
+  FinishLimbs(size);
+
   return *this;
 }
 
+/**
+ * @brief Rotate right operation within the @a length_ of the StdLogicVector
+ *   (i.e., the VHDL @c rotate_right).
+ * @param _bits Number of bits to be rotated to the right. Negative values
+ *   rotate to the left.
+ * @return The rotated StdLogicVector.
+ */
+StdLogicVector & StdLogicVector::RotateRight(int _bits) {
+  if ( length_ == 0 ) {
+    return *this;
+  }
+  return RotateLeft(-(_bits % length_));
+}
+
 /**
  * @brief Bitwise AND operation.
  * @param _operand The StdLogicVector to perform the AND operation with.
  * @return The result of the bitwise AND operation.
  */
 StdLogicVector & StdLogicVector::And(const StdLogicVector & _operand) {
-  mpz_and(value_, value_, _operand.getValue());
+  mp_size_t size = min<mp_size_t>(mpz_size(value_), mpz_size(_operand.value_));
+  mp_limb_t * limbs = ModifyLimbs(size);
+  const mp_limb_t * opLimbs = _operand.value_->_mp_d;
+
+  if ( size <= kLoopLimbs ) {
+    for (mp_size_t i = 0; i < size; ++i) {
+      limbs[i] &= opLimbs[i];
+    }
+  } else {
+    ActiveBitwiseKernels().And(limbs, limbs, opLimbs, size);
+  }
+  FinishLimbs(size);
+
   return *this;
 }
 
@@ -438,7 +1387,25 @@ StdLogicVector & StdLogicVector::And(const StdLogicVector & _operand) {
  * @return The result of the bitwise OR operation.
  */
 StdLogicVector & StdLogicVector::Or(const StdLogicVector & _operand) {
-  mpz_ior(value_, value_, _operand.getValue());
+  mp_size_t opSize = mpz_size(_operand.value_);
+  mp_size_t size   = max<mp_size_t>(mpz_size(value_), opSize);
+  mp_limb_t * limbs = ModifyLimbs(size);
+  // Note that the operand's limbs may only be read after the storage of this
+  // StdLogicVector has been prepared, since both might be the same.
+  const mp_limb_t * opLimbs = _operand.value_->_mp_d;
+
+  if ( opSize <= kLoopLimbs ) {
+    for (mp_size_t i = 0; i < opSize; ++i) {
+      limbs[i] |= opLimbs[i];
+    }
+  } else {
+    ActiveBitwiseKernels().Or(limbs, limbs, opLimbs, opSize);
+  }
+  FinishLimbs(size);
+  if ( isWrapping_ ) {
+    MaskToWidth(length_);
+  }
+
   return *this;
 }
 
@@ -448,7 +1415,104 @@ StdLogicVector & StdLogicVector::Or(const StdLogicVector & _operand) {
  * @return The result of the bitwise XOR operation.
  */
 StdLogicVector & StdLogicVector::Xor(const StdLogicVector & _operand) {
-  mpz_xor(value_, value_, _operand.getValue());
+  mp_size_t opSize = mpz_size(_operand.value_);
+  mp_size_t size   = max<mp_size_t>(mpz_size(value_), opSize);
+  mp_limb_t * limbs = ModifyLimbs(size);
+  const mp_limb_t * opLimbs = _operand.value_->_mp_d;
+
+  if ( opSize <= kLoopLimbs ) {
+    for (mp_size_t i = 0; i < opSize; ++i) {
+      limbs[i] ^= opLimbs[i];
+    }
+  } else {
+    ActiveBitwiseKernels().Xor(limbs, limbs, opLimbs, opSize);
+  }
+  FinishLimbs(size);
+  if ( isWrapping_ ) {
+    MaskToWidth(length_);
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Bitwise AND operation with a range of bits of a StdLogicVector.
+ * @param _operand The view to perform the AND operation with.
+ * @return The result of the bitwise AND operation.
+ */
+StdLogicVector & StdLogicVector::And(
+		const StdLogicVectorConstView & _operand) {
+  mp_size_t size;
+  mp_limb_t * limbs;
+
+  if ( _operand.Overlaps(*this) ) {
+    return this->And(_operand.ToStdLogicVector());
+  }
+
+  size  = min<mp_size_t>(mpz_size(value_),
+      LimbsForWidth(_operand.getLength()));
+  limbs = ModifyLimbs(size);
+  for (mp_size_t i = 0; i < size; ++i) {
+    limbs[i] &= _operand.getLimb(i);
+  }
+  FinishLimbs(size);
+
+  return *this;
+}
+
+/**
+ * @brief Bitwise OR operation with a range of bits of a StdLogicVector.
+ * @param _operand The view to perform the OR operation with.
+ * @return The result of the bitwise OR operation.
+ */
+StdLogicVector & StdLogicVector::Or(
+		const StdLogicVectorConstView & _operand) {
+  mp_size_t opSize = LimbsForWidth(_operand.getLength());
+  mp_size_t size;
+  mp_limb_t * limbs;
+
+  if ( _operand.Overlaps(*this) ) {
+    return this->Or(_operand.ToStdLogicVector());
+  }
+
+  size  = max<mp_size_t>(mpz_size(value_), opSize);
+  limbs = ModifyLimbs(size);
+  for (mp_size_t i = 0; i < opSize; ++i) {
+    limbs[i] |= _operand.getLimb(i);
+  }
+  FinishLimbs(size);
+  if ( isWrapping_ ) {
+    MaskToWidth(length_);
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Bitwise XOR operation with a range of bits of a StdLogicVector.
+ * @param _operand The view to perform the XOR operation with.
+ * @return The result of the bitwise XOR operation.
+ */
+StdLogicVector & StdLogicVector::Xor(
+		const StdLogicVectorConstView & _operand) {
+  mp_size_t opSize = LimbsForWidth(_operand.getLength());
+  mp_size_t size;
+  mp_limb_t * limbs;
+
+  if ( _operand.Overlaps(*this) ) {
+    return this->Xor(_operand.ToStdLogicVector());
+  }
+
+  size  = max<mp_size_t>(mpz_size(value_), opSize);
+  limbs = ModifyLimbs(size);
+  for (mp_size_t i = 0; i < opSize; ++i) {
+    limbs[i] ^= _operand.getLimb(i);
+  }
+  FinishLimbs(size);
+  if ( isWrapping_ ) {
+    MaskToWidth(length_);
+  }
+
   return *this;
 }
 
@@ -475,11 +1539,34 @@ StdLogicVector & StdLogicVector::Add(const StdLogicVector & _operand) {
  */
 StdLogicVector & StdLogicVector::Add(const StdLogicVector & _operand,
 		bool _truncateCarry) {
-  mpz_add(value_, value_, _operand.getValue());
+  mp_size_t opSize = mpz_size(_operand.getValue());
+  mp_size_t size   = max<mp_size_t>(mpz_size(value_), opSize) + 1;
+  mp_size_t addSize;
+  mp_limb_t * limbs;
+  mp_limb_t carry;
+
+  // When truncating the carry, no limb beyond the length of the
+  // StdLogicVector has to be computed at all.
+  _truncateCarry = _truncateCarry || isWrapping_;
+  if ( _truncateCarry ) {
+    size = min(size, LimbsForWidth(length_));
+  }
+  addSize = min(opSize, size);
+
+  limbs = ModifyLimbs(size);
+  if ( addSize > 0 ) {
+    carry = AddLimbs(limbs, limbs, mpz_limbs_read(_operand.getValue()),
+        addSize);
+    if ( size > addSize ) {
+      mpn_add_1(limbs + addSize, limbs + addSize, size - addSize, carry);
+    }
+  }
+  FinishLimbs(size);
+
   if ( _truncateCarry ){
   	// Length should be kept the same as the original StdLogicVector. Thus,
   	// truncate a potential carry.
-  	this->And(StdLogicVector(Ones(length_), 2, length_));
+  	MaskToWidth(length_);
   } else {
   	// Resulting StdLogicVector (sum) may have increased by one bit. Thus,
   	// also increase its length.
@@ -489,6 +1576,494 @@ StdLogicVector & StdLogicVector::Add(const StdLogicVector & _operand,
   return *this;
 }
 
+/**
+ * @brief Addition of a range of bits of a StdLogicVector. The carry is
+ *   truncated.
+ * @param _operand The view to perform the addition with.
+ * @return The sum of the StdLogicVector and the view.
+ */
+StdLogicVector & StdLogicVector::Add(
+		const StdLogicVectorConstView & _operand) {
+	return this->Add(_operand, true);
+}
+
+/**
+ * @brief Addition of a range of bits of a StdLogicVector.
+ * @param _operand The view to perform the addition with.
+ * @param _truncateCarry Determines whether to truncate the carry of the sum
+ *   (see Add(const StdLogicVector &, bool)).
+ * @return The sum of the StdLogicVector and the view.
+ */
+StdLogicVector & StdLogicVector::Add(
+		const StdLogicVectorConstView & _operand,
+		bool _truncateCarry) {
+  mp_size_t size = max<mp_size_t>(mpz_size(value_),
+      LimbsForWidth(_operand.getLength())) + 1;
+  mp_limb_t * limbs;
+  mp_limb_t carry = 0;
+
+  if ( _operand.Overlaps(*this) ) {
+    return this->Add(_operand.ToStdLogicVector(), _truncateCarry);
+  }
+
+  _truncateCarry = _truncateCarry || isWrapping_;
+  if ( _truncateCarry ) {
+    size = min(size, LimbsForWidth(length_));
+  }
+
+  limbs = ModifyLimbs(size);
+  for (mp_size_t i = 0; i < size; ++i) {
+    mp_limb_t sum = limbs[i] + _operand.getLimb(i);
+    mp_limb_t carryOut = (sum < limbs[i]) ? 1 : 0;
+    limbs[i] = sum + carry;
+    carry = carryOut | ((limbs[i] < sum) ? 1 : 0);
+  }
+  FinishLimbs(size);
+
+  if ( _truncateCarry ) {
+  	MaskToWidth(length_);
+  } else {
+  	length_ = length_ + 1;
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Subtraction of another StdLogicVector modulo 2^@a length_ (i.e., the
+ *   borrow is truncated). The operand is treated as unsigned.
+ * @param _operand The StdLogicVector to be subtracted.
+ * @return The difference of the two StdLogicVectors.
+ */
+StdLogicVector & StdLogicVector::Sub(const StdLogicVector & _operand) {
+  return this->Sub(_operand, kUnsigned);
+}
+
+/**
+ * @brief Subtraction of another StdLogicVector modulo 2^@a length_.
+ * @param _operand The StdLogicVector to be subtracted.
+ * @param _signedness Determines how an operand being shorter than this
+ *   StdLogicVector is extended: with zeros (kUnsigned) or with its sign bit
+ *   (kSigned).
+ * @return The difference of the two StdLogicVectors.
+ */
+StdLogicVector & StdLogicVector::Sub(const StdLogicVector & _operand,
+    Signedness _signedness) {
+  mp_size_t size = LimbsForWidth(length_);
+  mp_size_t opSize;
+  mp_limb_t local[kUnrolledLimbs];
+  vector<mp_limb_t> heap;
+  mp_limb_t * extended = NULL;
+  const mp_limb_t * b;
+  mp_limb_t * limbs;
+  mp_limb_t borrow;
+
+  if ( size == 0 ) {
+    return *this;
+  }
+  // Unless the limbs of the operand already equal its extension, it is
+  // extended into scratch limbs (dropping any bits above its length).
+  if ( _operand.IsExtended(size, _signedness) ) {
+    opSize = min<mp_size_t>(mpz_size(_operand.value_), size);
+  } else {
+    extended = (size <= kUnrolledLimbs) ? local :
+        (heap.resize(size), heap.data());
+    _operand.ExtendLimbs(extended, size, _signedness);
+    opSize = size;
+  }
+  // The operand is read only now, as ModifyLimbs() moves the limbs if it is
+  // this StdLogicVector itself.
+  limbs = ModifyLimbs(size);
+  b = (extended != NULL) ? extended : _operand.value_->_mp_d;
+  if ( opSize > 0 ) {
+    borrow = SubLimbs(limbs, limbs, b, opSize);
+    if ( borrow != 0 && size > opSize ) {
+      mpn_sub_1(limbs + opSize, limbs + opSize, size - opSize, borrow);
+    }
+  }
+  MaskTopLimb(limbs, length_);
+  FinishLimbs(size);
+
+  return *this;
+}
+
+/**
+ * @brief Replaces the value by its two's complement (i.e., 2^@a length_ minus
+ *   the value).
+ * @return The negated StdLogicVector.
+ */
+StdLogicVector & StdLogicVector::Negate() {
+  mp_size_t size = LimbsForWidth(length_);
+  mp_limb_t * limbs;
+
+  if ( size == 0 ) {
+    return *this;
+  }
+  limbs = ModifyLimbs(size);
+  mpn_neg(limbs, limbs, size);
+  MaskTopLimb(limbs, length_);
+  FinishLimbs(size);
+
+  return *this;
+}
+
+/**
+ * @brief Multiplication with another StdLogicVector modulo 2^@a length_. The
+ *   operand is treated as unsigned.
+ * @param _operand The StdLogicVector to perform the multiplication with.
+ * @return The truncated product of the two StdLogicVectors.
+ */
+StdLogicVector & StdLogicVector::Mul(const StdLogicVector & _operand) {
+  return this->Mul(_operand, true, kUnsigned);
+}
+
+/**
+ * @brief Multiplication with another StdLogicVector.
+ * @param _operand The StdLogicVector to perform the multiplication with.
+ * @param _truncate Determines whether to truncate the product. If @c true,
+ *   the product will have the length of the original StdLogicVector. If
+ *   @c false, the product will have the summed length of both operands (as
+ *   the numeric_std multiplication). Products of wrapping StdLogicVectors are
+ *   always truncated.
+ * @param _signedness Determines whether both operands are interpreted as
+ *   unsigned numbers or as two's complement numbers.
+ * @return The product of the two StdLogicVectors.
+ */
+StdLogicVector & StdLogicVector::Mul(const StdLogicVector & _operand,
+    bool _truncate, Signedness _signedness) {
+  int width;
+  mp_size_t size, aSize, bSize, productSize, scratchSize;
+  mp_limb_t local[5 * kUnrolledLimbs];
+  mp_limb_t * scratch;
+  mp_limb_t * product;
+  const mp_limb_t * a;
+  const mp_limb_t * b;
+  mp_limb_t * limbs;
+
+  _truncate = _truncate || isWrapping_;
+  width = _truncate ? length_ : length_ + _operand.length_;
+  size  = LimbsForWidth(width);
+
+  // The truncated product (as well as the signed one, whose operands are
+  // sign-extended to the width of the product) only requires the lower
+  // triangle of the multiplication. The full unsigned product is computed
+  // from the operands at their own lengths.
+  if ( _truncate || _signedness == kSigned ) {
+    aSize = bSize = size;
+  } else {
+    aSize = LimbsForWidth(length_);
+    bSize = LimbsForWidth(_operand.length_);
+  }
+  if ( aSize == 0 || bSize == 0 ) {
+    FinishLimbs(0);
+    length_ = width;
+    return *this;
+  }
+
+  // Products of a single limb are computed directly.
+  if ( size == 1 ) {
+    mp_limb_t a0 = (mpz_size(value_) > 0) ? value_->_mp_d[0] : 0;
+    mp_limb_t b0 = (mpz_size(_operand.value_) > 0) ?
+        _operand.value_->_mp_d[0] : 0;
+
+    a0 = ExtendLimb(a0, length_, _signedness == kSigned);
+    b0 = ExtendLimb(b0, _operand.length_, _signedness == kSigned);
+    limbs = ModifyLimbs(1);
+    limbs[0] = a0 * b0;
+    MaskTopLimb(limbs, width);
+    FinishLimbs(1);
+    length_ = width;
+    return *this;
+  }
+
+  // The product is computed in scratch limbs, such that this StdLogicVector
+  // may be its own operand. Operands are read in place unless they have to be
+  // extended, and the truncated product requires 2 * size limbs of scratch.
+  productSize = (aSize == size) ? size : aSize + bSize;
+  scratchSize = productSize + aSize + bSize +
+      ((aSize == size) ? 2 * size : 0);
+  if ( scratchSize <= 5 * kUnrolledLimbs ) {
+    scratch = local;
+  } else {
+    if ( tMulScratch.size() < static_cast<size_t>(scratchSize) ) {
+      tMulScratch.resize(scratchSize);
+    }
+    scratch = tMulScratch.data();
+  }
+  product = scratch;
+  a = ReadExtendedLimbs(aSize, _signedness, product + productSize);
+  b = _operand.ReadExtendedLimbs(bSize, _signedness,
+      product + productSize + aSize);
+  scratch = product + productSize + aSize + bSize;
+  if ( aSize == size ) {
+    MulLowLimbs(product, a, b, size, scratch);
+  } else {
+    MulLimbs(product, a, aSize, b, bSize);
+  }
+
+  limbs = ModifyLimbs(size);
+  for (mp_size_t i = 0; i < size; ++i) {
+    limbs[i] = product[i];
+  }
+  MaskTopLimb(limbs, width);
+  FinishLimbs(size);
+  length_ = width;
+
+  return *this;
+}
+
+/**
+ * @brief Squares the StdLogicVector modulo 2^@a length_.
+ * @return The truncated square of the StdLogicVector.
+ */
+StdLogicVector & StdLogicVector::Square() {
+  return this->Mul(*this, true, kUnsigned);
+}
+
+/**
+ * @brief Squares the StdLogicVector.
+ * @param _truncate Determines whether to truncate the square to the length of
+ *   the original StdLogicVector, or to keep all twice as many bits.
+ * @param _signedness Determines whether the value is interpreted as an
+ *   unsigned number or as a two's complement number.
+ * @return The square of the StdLogicVector.
+ */
+StdLogicVector & StdLogicVector::Square(bool _truncate,
+    Signedness _signedness) {
+  return this->Mul(*this, _truncate, _signedness);
+}
+
+/**
+ * @brief Compares the numeric values of two StdLogicVectors, which may differ
+ *   in length (i.e., the numeric_std relational operators).
+ * @param _operand The StdLogicVector to compare with.
+ * @param _signedness Determines whether both values are interpreted as
+ *   unsigned numbers or as two's complement numbers.
+ * @return A negative value if this StdLogicVector is less than @p _operand,
+ *   zero if both are equal, and a positive value otherwise.
+ */
+int StdLogicVector::Compare(const StdLogicVector & _operand,
+    Signedness _signedness) const {
+  mp_size_t size = LimbsForWidth(max(length_, _operand.length_));
+  mp_limb_t local[2 * kUnrolledLimbs];
+  vector<mp_limb_t> heap;
+  mp_limb_t * a;
+  mp_limb_t * b;
+  int result;
+
+  if ( size == 0 ) {
+    return 0;
+  }
+  a = (size <= kUnrolledLimbs) ? local : (heap.resize(2 * size), heap.data());
+  b = a + size;
+  ExtendLimbs(a, size, _signedness);
+  _operand.ExtendLimbs(b, size, _signedness);
+
+  // Flipping the (extended) sign bits maps two's complement numbers onto
+  // unsigned ones of the same order.
+  if ( _signedness == kSigned ) {
+    a[size - 1] ^= static_cast<mp_limb_t>(1) << (GMP_NUMB_BITS - 1);
+    b[size - 1] ^= static_cast<mp_limb_t>(1) << (GMP_NUMB_BITS - 1);
+  }
+  result = mpn_cmp(a, b, size);
+  return (result > 0) - (result < 0);
+}
+
+/**
+ * @brief Carry-less multiplication with another StdLogicVector modulo
+ *   x^@a length_. Both StdLogicVectors are treated as polynomials over GF(2),
+ *   where bit i holds the coefficient of x^i.
+ * @param _operand The StdLogicVector to perform the multiplication with.
+ * @return The truncated carry-less product of the two StdLogicVectors.
+ */
+StdLogicVector & StdLogicVector::ClMul(const StdLogicVector & _operand) {
+  return this->ClMul(_operand, true);
+}
+
+/**
+ * @brief Carry-less multiplication with another StdLogicVector (see
+ *   ClMul(const StdLogicVector &)).
+ * @param _operand The StdLogicVector to perform the multiplication with.
+ * @param _truncate Determines whether to truncate the product. If @c true,
+ *   the product will have the length of the original StdLogicVector. If
+ *   @c false, the product will have the summed length of both operands minus
+ *   one, which holds any product without loss. Products of wrapping
+ *   StdLogicVectors are always truncated.
+ * @return The carry-less product of the two StdLogicVectors.
+ */
+StdLogicVector & StdLogicVector::ClMul(const StdLogicVector & _operand,
+    bool _truncate) {
+  mp_size_t aSize = mpz_size(value_);
+  mp_size_t bSize = mpz_size(_operand.value_);
+  mp_limb_t local[2 * kUnrolledLimbs];
+  vector<mp_limb_t> heap;
+  mp_limb_t * product;
+  mp_limb_t * limbs;
+  mp_size_t size;
+  int width;
+
+  _truncate = _truncate || isWrapping_;
+  width = _truncate ? length_ : max(length_ + _operand.length_ - 1, 0);
+  size  = LimbsForWidth(width);
+  if ( aSize == 0 || bSize == 0 || size == 0 ) {
+    FinishLimbs(0);
+    length_ = width;
+    return *this;
+  }
+
+  // The product is computed into scratch limbs, such that it may be written
+  // to this StdLogicVector even if it is also the operand.
+  product = (aSize + bSize <= 2 * kUnrolledLimbs) ? local :
+      (heap.resize(aSize + bSize), heap.data());
+  if ( &_operand == this ) {
+    ClSquareLimbs(product, mpz_limbs_read(value_), aSize);
+  } else {
+    ClMulLimbs(product, mpz_limbs_read(value_), aSize,
+        mpz_limbs_read(_operand.value_), bSize);
+  }
+
+  limbs = ModifyLimbs(min(size, aSize + bSize));
+  mpn_copyi(limbs, product, min(size, aSize + bSize));
+  if ( size <= aSize + bSize ) {
+    MaskTopLimb(limbs, width);
+  }
+  FinishLimbs(min(size, aSize + bSize));
+  length_ = width;
+
+  return *this;
+}
+
+/**
+ * @brief Multiplication in the binary field GF(2^m) defined by a modulus
+ *   polynomial of degree m (e.g., x^8 + x^4 + x^3 + x + 1 for AES or
+ *   x^128 + x^7 + x^2 + x + 1 for GCM). Both StdLogicVectors are treated as
+ *   polynomials over GF(2) (see ClMul()), but need not be reduced.
+ * @param _operand The StdLogicVector to perform the multiplication with.
+ * @param _modulus The modulus polynomial, which must have a degree of at least
+ *   one.
+ * @return The reduced product, having a length of m bits.
+ */
+StdLogicVector & StdLogicVector::GfMul(const StdLogicVector & _operand,
+    const StdLogicVector & _modulus) {
+  long m = (mpz_sgn(_modulus.value_) == 0) ? -1 :
+      static_cast<long>(mpz_sizeinbase(_modulus.value_, 2)) - 1;
+  mp_size_t aSize = mpz_size(value_);
+  mp_size_t bSize = mpz_size(_operand.value_);
+  mp_limb_t local[4 * kUnrolledLimbs];
+  vector<mp_limb_t> heap;
+  mp_limb_t * product;
+  mp_limb_t * limbs;
+  mp_size_t size;
+
+  if ( m < 1 || aSize == 0 || bSize == 0 ) {
+    FinishLimbs(0);
+    length_ = max(m, 0L);
+    return *this;
+  }
+
+  product = (aSize + bSize <= 2 * kUnrolledLimbs) ? local :
+      (heap.resize(2 * (aSize + bSize)), heap.data());
+  if ( &_operand == this ) {
+    ClSquareLimbs(product, mpz_limbs_read(value_), aSize);
+  } else {
+    ClMulLimbs(product, mpz_limbs_read(value_), aSize,
+        mpz_limbs_read(_operand.value_), bSize);
+  }
+  ReducePolyLimbs(product, aSize + bSize, mpz_limbs_read(_modulus.value_), m,
+      product + aSize + bSize);
+
+  size  = min(LimbsForWidth(m), aSize + bSize);
+  limbs = ModifyLimbs(size);
+  mpn_copyi(limbs, product, size);
+  FinishLimbs(size);
+  length_ = m;
+
+  return *this;
+}
+
+/**
+ * @brief Squaring in the binary field GF(2^m) defined by a modulus polynomial
+ *   of degree m (see GfMul()). Since squaring over GF(2) merely spreads the
+ *   bits, it is considerably cheaper than a multiplication.
+ * @param _modulus The modulus polynomial, which must have a degree of at least
+ *   one.
+ * @return The reduced square, having a length of m bits.
+ */
+StdLogicVector & StdLogicVector::GfSquare(const StdLogicVector & _modulus) {
+  return this->GfMul(*this, _modulus);
+}
+
+/**
+ * @brief Inversion in the binary field GF(2^m) defined by a modulus
+ *   polynomial of degree m (see GfMul()), using the extended Euclidean
+ *   algorithm for polynomials.
+ * @param _modulus The modulus polynomial, which must have a degree of at least
+ *   one.
+ * @return The inverse, having a length of m bits. Elements without an inverse
+ *   (i.e., zero, or non-trivial divisors of a reducible modulus) yield zero,
+ *   which matches the convention of the AES S-box.
+ */
+StdLogicVector & StdLogicVector::GfInv(const StdLogicVector & _modulus) {
+  long m = (mpz_sgn(_modulus.value_) == 0) ? -1 :
+      static_cast<long>(mpz_sizeinbase(_modulus.value_, 2)) - 1;
+  mp_size_t aSize = mpz_size(value_);
+  mp_size_t n = m / GMP_NUMB_BITS + 1;
+  mp_size_t uSize = max(aSize, n);
+  mp_limb_t local[8 * kUnrolledLimbs];
+  vector<mp_limb_t> heap;
+  mp_limb_t * u;
+  mp_limb_t * v;
+  mp_limb_t * g1;
+  mp_limb_t * g2;
+  mp_limb_t * limbs;
+  mp_size_t size;
+  long du, dv;
+
+  if ( m < 1 || aSize == 0 ) {
+    FinishLimbs(0);
+    length_ = max(m, 0L);
+    return *this;
+  }
+
+  // The value is reduced first, using the limbs following it as scratch.
+  u  = (2 * uSize + 3 * n <= 8 * kUnrolledLimbs) ? local :
+      (heap.resize(2 * uSize + 3 * n), heap.data());
+  v  = u + 2 * uSize;
+  g1 = v + n;
+  g2 = g1 + n;
+  mpn_copyi(u, mpz_limbs_read(value_), aSize);
+  mpn_zero(u + aSize, uSize - aSize);
+  ReducePolyLimbs(u, uSize, mpz_limbs_read(_modulus.value_), m, u + uSize);
+  mpn_copyi(v, mpz_limbs_read(_modulus.value_), n);
+  mpn_zero(g1, 2 * n);
+  g1[0] = 1;
+
+  // Invariants: u = g1 * a and v = g2 * a (mod f).
+  du = PolyDegree(u, n);
+  dv = m;
+  while ( du > 0 ) {
+    long shift = du - dv;
+
+    if ( shift < 0 ) {
+      swap(u, v);
+      swap(g1, g2);
+      swap(du, dv);
+      shift = -shift;
+    }
+    XorShiftedLimbs(u, n, v, n, shift);
+    XorShiftedLimbs(g1, n, g2, n, shift);
+    du = PolyDegree(u, n);
+  }
+
+  size = (du == 0) ? LimbsForWidth(m) : 0;
+  limbs = ModifyLimbs(size);
+  mpn_copyi(limbs, g1, size);
+  FinishLimbs(size);
+  length_ = m;
+
+  return *this;
+}
+
 /**
  * @brief Truncates the StdLogicVector after @p _width bits.
  * @param _width Number of preserved bits (others will be truncated).
@@ -496,9 +2071,8 @@ StdLogicVector & StdLogicVector::Add(const StdLogicVector & _operand,
  * @todo Error handling when size of StdLogicVector is smaller than @p _width.
  */
 StdLogicVector & StdLogicVector::TruncateAfter(int _width) {
-	StdLogicVector tmp(Ones(_width), 2, _width);
 	length_ = _width;
-	this->And(tmp);
+	MaskToWidth(_width);
 	return *this;
 }
 
@@ -515,26 +2089,114 @@ StdLogicVector & StdLogicVector::TruncateAfter(int _width) {
  *   another StdLogicVector.
  */
 StdLogicVector & StdLogicVector::ReplaceBits(int _begin, const StdLogicVector & _input) {
-	// Determine which bits have to be masked.
-	string leadingOnes = Ones(max(length_ - (_begin + _input.getLength()), 0));
-	string intermediateZeroes = Zeros(min(_input.getLength(), length_));
-	string trailingOnes = Ones(max(length_ - static_cast<int>(leadingOnes.length())
-			- _input.getLength(), 0));
+	mp_size_t size = mpz_size(value_);
+	mp_size_t newSize;
+	int width;
+	mp_limb_t * limbs;
+
+	if ( &_input == this ) {
+		return this->ReplaceBits(_begin, StdLogicVector(_input));
+	}
+
+	// Determine which bits have to be replaced.
+	_begin = max(_begin, 0);
+	width  = min(_input.getLength(), length_ - _begin);
+	if ( width <= 0 ) {
+		return *this;
+	}
 
-	// Create a mask for the bits to be replaces.
-	StdLogicVector tmp = StdLogicVector(
-			(leadingOnes + intermediateZeroes + trailingOnes), 2, length_);
+	// Deposit the replacement bits directly into the limbs.
+	newSize = max<mp_size_t>(size, LimbsForWidth(_begin + width));
+	limbs = ModifyLimbs(newSize);
+	DepositBits(limbs, _begin, mpz_limbs_read(_input.getValue()),
+			mpz_size(_input.getValue()), 0, width);
+	FinishLimbs(newSize);
+
+	return *this;
+}
+
+/**
+ * @brief Extracts a range of bits from the StdLogicVector (i.e., the VHDL
+ *   slice @c a(hi @c downto @c lo)).
+ *
+ * @param _hi The 0-based index of the most significant bit to be extracted.
+ * @param _lo The 0-based index of the least significant bit to be extracted.
+ * @return A new StdLogicVector of length @p _hi - @p _lo + 1 holding the
+ *   extracted bits.
+ */
+StdLogicVector StdLogicVector::Extract(int _hi, int _lo) const {
+	int width = max(_hi - max(_lo, 0) + 1, 0);
+	StdLogicVector result(static_cast<unsigned int>(width));
+	mp_size_t size = LimbsForWidth(width);
+	mp_limb_t * limbs = result.ModifyLimbs(size);
 
-	// Clear the bits to be replaced.
-	this->And(tmp);
+	DepositBits(limbs, 0, mpz_limbs_read(value_), mpz_size(value_),
+			max(_lo, 0), width);
+	result.FinishLimbs(size);
 
-	// Generate the replacement bit vector.
-	tmp = StdLogicVector((Zeros(leadingOnes.length()) +
-			_input.ToString(2,true) + Zeros(trailingOnes.length())), 2, length_);
+	return result;
+}
 
-	// Replace the previously cleared bits with those from the replacement bit
-	// vector.
-	return this->Or(tmp);
+/**
+ * @brief Creates a view onto the bits @p _hi @c downto @p _lo of the
+ *   StdLogicVector, which allows reading and writing these bits without
+ *   copying them.
+ *
+ * @param _hi The 0-based index of the most significant bit of the view.
+ * @param _lo The 0-based index of the least significant bit of the view.
+ * @return A StdLogicVectorView referring to the bits of @c this.
+ */
+StdLogicVectorView StdLogicVector::Slice(int _hi, int _lo) {
+	return StdLogicVectorView(*this, _hi, _lo);
+}
+
+/**
+ * @brief Creates a read-only view onto the bits @p _hi @c downto @p _lo of the
+ *   StdLogicVector, which allows reading these bits without copying them.
+ *
+ * @param _hi The 0-based index of the most significant bit of the view.
+ * @param _lo The 0-based index of the least significant bit of the view.
+ * @return A StdLogicVectorConstView referring to the bits of @c this.
+ */
+StdLogicVectorConstView StdLogicVector::Slice(int _hi, int _lo) const {
+	return StdLogicVectorConstView(*this, _hi, _lo);
+}
+
+/**
+ * @brief Concatenates a number of StdLogicVectors (i.e., the VHDL expression
+ *   @c a @c & @c b @c & @c c).
+ *
+ * The total length is determined up front, such that the result is allocated
+ * only once. Each operand is then deposited at its offset limb by limb.
+ *
+ * @param _parts The StdLogicVectors to be concatenated. The first one ends up
+ *   in the most significant bits, the last one in the least significant bits.
+ *   Bits of an operand beyond its length are ignored.
+ * @param _count The number of StdLogicVectors to be concatenated.
+ * @return A StdLogicVector of the summed length of all operands.
+ */
+StdLogicVector StdLogicVector::Concat(const StdLogicVector * const _parts[],
+		int _count) {
+	int length = 0;
+	int offset = 0;
+
+	for (int i = 0; i < _count; ++i) {
+		length += max(_parts[i]->getLength(), 0);
+	}
+
+	StdLogicVector result(static_cast<unsigned int>(length));
+	mp_size_t size = LimbsForWidth(length);
+	mp_limb_t * limbs = result.ModifyLimbs(size);
+
+	for (int i = _count - 1; i >= 0; --i) {
+		const mpz_t & value = _parts[i]->getValue();
+		DepositBits(limbs, offset, mpz_limbs_read(value), mpz_size(value), 0,
+				max(_parts[i]->getLength(), 0));
+		offset += max(_parts[i]->getLength(), 0);
+	}
+	result.FinishLimbs(size);
+
+	return result;
 }
 
 /**
@@ -553,8 +2215,10 @@ StdLogicVector & StdLogicVector::PadRightZeros(int _width) {
 	if ( _width < length_ ) {
 		//TODO: Throw error.
 	}
-	this->ShiftLeft(_width - length_);
+	int bits = _width - length_;
+
 	length_ = _width;
+	this->ShiftLeft(bits);
 
 	return *this;
 }
@@ -562,23 +2226,499 @@ StdLogicVector & StdLogicVector::PadRightZeros(int _width) {
 /**
  * @brief Reverses the bit order of the StdLogicVector.
  *
+ * The limbs covering the @a length_ of the StdLogicVector are reversed as a
+ * whole and the result is shifted back into place. Bits beyond the
+ * @a length_ of the StdLogicVector are discarded.
+ *
  * @return The original StdLogicVector with its value in reversed bit order.
  */
 StdLogicVector & StdLogicVector::ReverseBitOrder() {
-	string strBinary = this->ToString(2, true);
-	string reverse = string ( strBinary.rbegin(), strBinary.rend() );
-	mpz_init_set_str(value_, reverse.c_str(), 2);
+	mp_size_t size = LimbsForWidth(length_);
+	unsigned int shift = size * GMP_NUMB_BITS - max(length_, 0);
+	mp_limb_t * limbs;
+
+	if ( size == 0 ) {
+		return *this;
+	}
+
+	limbs = ModifyLimbs(size);
+	ActiveShuffleKernels().Reverse(limbs, size);
+	if ( shift != 0 ) {
+		mpn_rshift(limbs, limbs, size, shift);
+	}
+	FinishLimbs(size);
+
 	return *this;
 }
 
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+/**
+ * @brief Initializes @a value_ as an empty value kept within the inline limbs
+ *   of the StdLogicVector.
+ *
+ * While being inline, @a value_ is a read-only GMP view onto @a inline_, which
+ * can be passed to any GMP function reading its value. All modifications of
+ * the value go through ModifyLimbs() and FinishLimbs().
+ */
+void StdLogicVector::InitInline() {
+  mpz_roinit_n(value_, inline_, 0);
+}
+
+/**
+ * @brief Slow path of ModifyLimbs() for values exceeding their storage. Inline
+ *   values are promoted to GMP-managed storage, while GMP-managed storage is
+ *   reallocated.
+ * @param _limbs Number of limbs which have to be writable.
+ * @return Pointer to at least @p _limbs limbs holding the current value. Limbs
+ *   beyond the current size of the value are set to zero.
+ */
+mp_limb_t * StdLogicVector::GrowLimbs(mp_size_t _limbs) {
+  mp_size_t size = mpz_size(value_);
+  mp_limb_t * limbs;
+
+  if ( IsInline() ) {
+    mpz_init2(value_, _limbs * GMP_NUMB_BITS);
+    limbs = mpz_limbs_write(value_, _limbs);
+    mpn_copyi(limbs, inline_, size);
+  } else {
+    limbs = mpz_limbs_modify(value_, _limbs);
+  }
+  mpn_zero(limbs + size, _limbs - size);
+  return limbs;
+}
+
+/**
+ * @brief Assigns a GMP value to the StdLogicVector, reusing its storage.
+ * @param _value The value to be assigned.
+ */
+void StdLogicVector::SetValue(mpz_srcptr _value) {
+  mp_size_t size = mpz_size(_value);
+  mp_limb_t * limbs = ModifyLimbs(size);
+
+  if ( size > 0 && limbs != mpz_limbs_read(_value) ) {
+    mpn_copyi(limbs, mpz_limbs_read(_value), size);
+  }
+  FinishLimbs(size);
+}
+
+/**
+ * @brief Assigns a value given as a string of digits to the StdLogicVector.
+ *
+ * Bases being a power of two are packed into the limbs directly (hexadecimal
+ * and binary digits a whole limb at a time). All other bases are validated and
+ * then converted by GMP.
+ *
+ * @param _first The first character (i.e., the most significant digit).
+ * @param _last The end of the characters.
+ * @param _base The base of the digits (2 to 62).
+ * @return The end of the characters and a default error code on success.
+ *   Otherwise, the first character not being a digit (or @p _first for an
+ *   empty string or an unsupported base) and errc::invalid_argument. In that
+ *   case, the value is cleared.
+ */
+from_chars_result StdLogicVector::SetDigits(const char * _first,
+    const char * _last, int _base) {
+  const char * pos = _last;
+  mp_bitcnt_t bit  = 0;
+  unsigned int bits;
+  mp_size_t size;
+  mp_limb_t * limbs;
+
+  if ( _first == _last || _base < 2 || _base > 62 ) {
+    FinishLimbs(0);
+    return { _first, errc::invalid_argument };
+  }
+
+  // Other bases: validate the digits, then let GMP do the conversion.
+  if ( (_base & (_base - 1)) != 0 || _base > 32 ) {
+    mpz_t tmp;
+
+    for (pos = _first; pos < _last; ++pos) {
+      if ( DigitValue(*pos, _base) < 0 ) {
+        FinishLimbs(0);
+        return { pos, errc::invalid_argument };
+      }
+    }
+    mpz_init_set_str(tmp, string(_first, _last).c_str(), _base);
+    SetValue(tmp);
+    mpz_clear(tmp);
+    return { _last, errc() };
+  }
+
+  // Leading zeros would only inflate the number of limbs.
+  while ( _last - _first > 1 && *_first == '0' ) {
+    _first++;
+  }
+  bits  = __builtin_ctz(_base);
+  size  = ((_last - _first) * bits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+  FinishLimbs(0);
+  limbs = ModifyLimbs(size);
+
+  // Whole limbs of hexadecimal or binary digits at once.
+  if ( bits == 4 || bits == 1 ) {
+    const ShuffleKernels & kernels = ActiveShuffleKernels();
+    mp_size_t perLimb = GMP_NUMB_BITS / bits;
+    mp_size_t whole   = (pos - _first) / perLimb;
+
+    whole = (bits == 4) ? kernels.ParseHex(limbs, pos, whole) :
+        kernels.ParseBinary(limbs, pos, whole);
+    pos -= whole * perLimb;
+    bit  = whole * GMP_NUMB_BITS;
+  }
+  // Pack the remaining digits, starting with the least significant one, and
+  // write each limb once it is complete.
+  mp_limb_t limb = 0;
+
+  for (; pos > _first; bit += bits) {
+    int digit = DigitValue(*--pos, _base);
+    unsigned int shift = bit % GMP_NUMB_BITS;
+
+    if ( digit < 0 ) {
+      for (pos = _first; DigitValue(*pos, _base) >= 0; ++pos) {}
+      FinishLimbs(0);
+      return { pos, errc::invalid_argument };
+    }
+    limb |= static_cast<mp_limb_t>(digit) << shift;
+    if ( shift + bits >= GMP_NUMB_BITS ) {
+      limbs[bit / GMP_NUMB_BITS] = limb;
+      limb = (shift + bits > GMP_NUMB_BITS) ?
+          static_cast<mp_limb_t>(digit) >> (GMP_NUMB_BITS - shift) : 0;
+    }
+  }
+  if ( bit % GMP_NUMB_BITS != 0 ) {
+    limbs[bit / GMP_NUMB_BITS] = limb;
+  }
+  FinishLimbs(size);
+  return { _last, errc() };
+}
+
+/**
+ * @brief Clears all bits of the value from bit @p _width upwards, without
+ *   changing the @a length_ of the StdLogicVector.
+ * @param _width Number of preserved bits.
+ */
+void StdLogicVector::MaskToWidth(int _width) {
+  mp_size_t size = mpz_size(value_);
+  mp_size_t keep = LimbsForWidth(_width);
+  unsigned int rem = max(_width, 0) % GMP_NUMB_BITS;
+  mp_limb_t * limbs;
+
+  if ( size < keep ) {
+    return;
+  }
+
+  limbs = ModifyLimbs(size);
+  if ( rem != 0 ) {
+    limbs[keep - 1] &= (static_cast<mp_limb_t>(1) << rem) - 1;
+  }
+  FinishLimbs(keep);
+}
+
+/**
+ * @brief Provides read access to the limbs of the value, limited to the bits
+ *   within the @a length_ of the StdLogicVector. Only if the value exceeds
+ *   the length (e.g., after ShiftLeft()), the limbs are copied and masked.
+ * @param _size Set to the number of limbs returned.
+ * @param _scratch Holds the copy of the limbs if required.
+ * @return The limbs of the value within the length.
+ */
+const mp_limb_t * StdLogicVector::ReadLimbsWithinLength(mp_size_t & _size,
+    vector<mp_limb_t> & _scratch) const {
+  const mp_limb_t * limbs = mpz_limbs_read(value_);
+  mp_size_t size = mpz_size(value_);
+  mp_size_t maxSize = LimbsForWidth(length_);
+  unsigned int rem = length_ % GMP_NUMB_BITS;
+
+  if ( size < maxSize || (size == maxSize &&
+       (size == 0 || rem == 0 || (limbs[size - 1] >> rem) == 0)) ) {
+    _size = size;
+    return limbs;
+  }
+  _scratch.assign(limbs, limbs + maxSize);
+  if ( maxSize > 0 ) {
+    MaskTopLimb(_scratch.data(), length_);
+  }
+  _size = maxSize;
+  return _scratch.data();
+}
+
+
+/**
+ * @brief Copies the value of the StdLogicVector into @p _size limbs. Bits
+ *   beyond the @a length_ of the StdLogicVector are filled with zeros
+ *   (unsigned) or with copies of its most significant bit (signed).
+ */
+void StdLogicVector::ExtendLimbs(mp_limb_t * _dst, mp_size_t _size,
+    Signedness _signedness) const {
+  const mp_limb_t * limbs = value_->_mp_d;
+  mp_size_t copy = min<mp_size_t>(mpz_size(value_), _size);
+  mp_size_t top  = length_ / GMP_NUMB_BITS;
+  mp_limb_t fill = 0;
+  mp_limb_t keep;
+
+  // Plain loops, as the operands of the arithmetic are mostly narrow.
+  for (mp_size_t i = 0; i < copy; ++i) {
+    _dst[i] = limbs[i];
+  }
+  for (mp_size_t i = copy; i < _size; ++i) {
+    _dst[i] = 0;
+  }
+  if ( top >= _size ) {
+    return;
+  }
+  if ( _signedness == kSigned && length_ > 0 &&
+       ((_dst[(length_ - 1) / GMP_NUMB_BITS] >>
+         ((length_ - 1) % GMP_NUMB_BITS)) & 1) != 0 ) {
+    fill = ~static_cast<mp_limb_t>(0);
+  }
+  keep = (static_cast<mp_limb_t>(1) << (length_ % GMP_NUMB_BITS)) - 1;
+  _dst[top] = (_dst[top] & keep) | (fill & ~keep);
+  for (mp_size_t i = top + 1; i < _size; ++i) {
+    _dst[i] = fill;
+  }
+}
+
+/**
+ * @brief Reads a full limb worth of bits from a limb array starting at an
+ *   arbitrary bit position.
+ * @param _limbs The limbs to read from.
+ * @param _size Number of valid limbs. Bits beyond these limbs read as zero.
+ * @param _bit The 0-based index of the first bit to be read.
+ * @return The bits @p _bit to @p _bit + GMP_NUMB_BITS - 1.
+ */
+mp_limb_t StdLogicVector::ReadLimb(const mp_limb_t * _limbs, mp_size_t _size,
+    mp_bitcnt_t _bit) {
+  mp_size_t index   = _bit / GMP_NUMB_BITS;
+  unsigned int shift = _bit % GMP_NUMB_BITS;
+  mp_limb_t limb;
+
+  if ( index >= _size ) {
+    return 0;
+  }
+  limb = _limbs[index] >> shift;
+  if ( shift != 0 && index + 1 < _size ) {
+    limb |= _limbs[index + 1] << (GMP_NUMB_BITS - shift);
+  }
+  return limb;
+}
+
+/**
+ * @brief Copies a range of bits from one limb array into another one,
+ *   leaving all other bits of the destination untouched.
+ *
+ * The bits are moved limb by limb, i.e., at most one read and one masked
+ * write are required per destination limb. The two limb arrays must not
+ * overlap.
+ *
+ * @param _dst The limbs to write to. They must cover bit
+ *   @p _dstBit + @p _width - 1.
+ * @param _dstBit The 0-based index of the first destination bit.
+ * @param _src The limbs to read from.
+ * @param _srcSize Number of valid source limbs (bits beyond read as zero).
+ * @param _srcBit The 0-based index of the first source bit.
+ * @param _width Number of bits to be copied.
+ */
+void StdLogicVector::DepositBits(mp_limb_t * _dst, mp_bitcnt_t _dstBit,
+    const mp_limb_t * _src, mp_size_t _srcSize, mp_bitcnt_t _srcBit,
+    mp_bitcnt_t _width) {
+  while ( _width > 0 ) {
+    unsigned int shift = _dstBit % GMP_NUMB_BITS;
+    mp_bitcnt_t bits   = min<mp_bitcnt_t>(GMP_NUMB_BITS - shift, _width);
+    mp_limb_t mask     = (bits == GMP_NUMB_BITS) ? ~static_cast<mp_limb_t>(0) :
+        ((static_cast<mp_limb_t>(1) << bits) - 1);
+    mp_limb_t limb     = ReadLimb(_src, _srcSize, _srcBit) & mask;
+    mp_limb_t * dst    = _dst + _dstBit / GMP_NUMB_BITS;
+
+    *dst = (*dst & ~(mask << shift)) | (limb << shift);
+
+    _dstBit += bits;
+    _srcBit += bits;
+    _width  -= bits;
+  }
+}
+
+/**
+ * @brief Replaces the value of the StdLogicVector by the value of an array of
+ *   unsigned words (bytes, 32-bit or 64-bit words).
+ *
+ * On little-endian hosts, the words are copied into the limbs as they are
+ * (in reverse order for big-endian input). Otherwise, each word is shifted
+ * into place individually.
+ *
+ * @param _words The words to be imported (each in the native byte order).
+ * @param _count The number of words of @p _words.
+ * @param _endian The order of the words.
+ */
+template <typename Word>
+void StdLogicVector::ImportWords(const Word * _words, size_t _count,
+    Endian _endian) {
+  mp_size_t size = (_count * sizeof(Word) + sizeof(mp_limb_t) - 1) /
+      sizeof(mp_limb_t);
+  mp_limb_t * limbs;
+
+  FinishLimbs(0);
+  limbs = ModifyLimbs(size);
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && GMP_NAIL_BITS == 0
+  if ( _endian == kLittleEndian ) {
+    memcpy(limbs, _words, _count * sizeof(Word));
+  } else {
+    for (size_t i = 0; i < _count; ++i) {
+      memcpy(reinterpret_cast<char *>(limbs) + i * sizeof(Word),
+          &_words[_count - 1 - i], sizeof(Word));
+    }
+  }
+#else
+  const unsigned int wordBits = sizeof(Word) * 8;
+
+  for (size_t i = 0; i < _count; ++i) {
+    Word word = _words[(_endian == kBigEndian) ? _count - 1 - i : i];
+    mp_bitcnt_t bit = static_cast<mp_bitcnt_t>(i) * wordBits;
+
+    // A word spans more than one limb only if limbs are narrower than words.
+    for (unsigned int k = 0; k < wordBits; k += GMP_NUMB_BITS) {
+      limbs[(bit + k) / GMP_NUMB_BITS] |= static_cast<mp_limb_t>(word >> k) <<
+          ((bit + k) % GMP_NUMB_BITS);
+    }
+  }
+#endif
+  FinishLimbs(size);
+}
+
+/**
+ * @brief Exports the value of the StdLogicVector into an array of unsigned
+ *   words (bytes, 32-bit or 64-bit words).
+ * @param _words The words to be filled (each in the native byte order).
+ * @param _count The number of words of @p _words.
+ * @param _endian The order of the words.
+ * @return False if @p _words cannot hold @a length_ bits, true otherwise.
+ */
+template <typename Word>
+bool StdLogicVector::ExportWords(Word * _words, size_t _count, Endian _endian)
+    const {
+  const unsigned int wordBits = sizeof(Word) * 8;
+  const mp_limb_t * limbs = mpz_limbs_read(value_);
+  mp_size_t size = mpz_size(value_);
+  size_t needed = (max(length_, 0) + wordBits - 1) / wordBits;
+  unsigned int rem = max(length_, 0) % wordBits;
+
+  if ( _count < needed ) {
+    return false;
+  }
+  if ( needed == 0 ) {
+    return true;
+  }
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && GMP_NAIL_BITS == 0
+  size_t bytes = min<size_t>(needed * sizeof(Word), size * sizeof(mp_limb_t));
+
+  memcpy(_words, limbs, bytes);
+  memset(reinterpret_cast<char *>(_words) + bytes, 0,
+      needed * sizeof(Word) - bytes);
+  if ( rem != 0 ) {
+    _words[needed - 1] &= static_cast<Word>((static_cast<uint64_t>(1) << rem) -
+        1);
+  }
+  if ( _endian == kBigEndian ) {
+    reverse(_words, _words + needed);
+  }
+#else
+  for (size_t i = 0; i < needed; ++i) {
+    mp_bitcnt_t bit = static_cast<mp_bitcnt_t>(i) * wordBits;
+    Word word = 0;
+
+    for (unsigned int k = 0; k < wordBits; k += GMP_NUMB_BITS) {
+      word |= static_cast<Word>(ReadLimb(limbs, size, bit + k)) << k;
+    }
+    if ( i == needed - 1 && rem != 0 ) {
+      word &= static_cast<Word>((static_cast<uint64_t>(1) << rem) - 1);
+    }
+    _words[(_endian == kBigEndian) ? needed - 1 - i : i] = word;
+  }
+#endif
+  return true;
+}
+
 
 // ****************************************************************************
-// Utility functions
+// Concatenation
 // ****************************************************************************
-string StdLogicVector::Zeros(int _length) {
-  return string(_length, '0');
+/**
+ * @brief Links two StdLogicVectors to be concatenated.
+ * @param _first The StdLogicVector ending up in the most significant bits.
+ * @param _last The StdLogicVector ending up in the least significant bits.
+ */
+StdLogicVectorConcat::StdLogicVectorConcat(const StdLogicVector & _first,
+    const StdLogicVector & _last) : head_(NULL), first_(&_first), last_(&_last)
+{
+  length_ = max(_first.getLength(), 0) + max(_last.getLength(), 0);
 }
 
-string StdLogicVector::Ones(int _length) {
-  return string(_length,'1');
+/**
+ * @brief Appends another StdLogicVector to a pending concatenation.
+ * @param _head The pending concatenation ending up in the most significant
+ *   bits.
+ * @param _last The StdLogicVector ending up in the least significant bits.
+ */
+StdLogicVectorConcat::StdLogicVectorConcat(StdLogicVectorConcat && _head,
+    const StdLogicVector & _last) : head_(&_head), first_(NULL), last_(&_last)
+{
+  length_ = _head.getLength() + max(_last.getLength(), 0);
+}
+
+/**
+ * @brief Returns the length of the concatenation.
+ * @return The summed length of all operands.
+ */
+int StdLogicVectorConcat::getLength() const {
+  return length_;
+}
+
+/**
+ * @brief Builds the concatenated StdLogicVector with a single allocation.
+ *
+ * The operands are visited from the least significant one (i.e., the last
+ * operand) to the most significant one, such that the offset of each operand
+ * is known without collecting them first.
+ */
+StdLogicVectorConcat::operator StdLogicVector() const && {
+  StdLogicVector result(static_cast<unsigned int>(length_));
+  mp_size_t size = StdLogicVector::LimbsForWidth(length_);
+  mp_limb_t * limbs = result.ModifyLimbs(size);
+  int offset = 0;
+
+  for (const StdLogicVectorConcat * node = this; node != NULL;
+       node = node->head_) {
+    const StdLogicVector * parts[2] = { node->last_, node->first_ };
+    for (int i = 0; i < 2 && parts[i] != NULL; ++i) {
+      const mpz_t & value = parts[i]->getValue();
+      int width = max(parts[i]->getLength(), 0);
+      StdLogicVector::DepositBits(limbs, offset, mpz_limbs_read(value),
+          mpz_size(value), 0, width);
+      offset += width;
+    }
+  }
+  result.FinishLimbs(size);
+
+  return result;
+}
+
+/**
+ * @brief Concatenation operator (i.e., the VHDL operator @c &).
+ * @return A pending concatenation, which is built once it is converted into
+ *   a StdLogicVector.
+ */
+StdLogicVectorConcat operator&(const StdLogicVector & _first,
+    const StdLogicVector & _last) {
+  return StdLogicVectorConcat(_first, _last);
+}
+
+/**
+ * @copydoc operator&(const StdLogicVector &, const StdLogicVector &)
+ */
+StdLogicVectorConcat operator&(StdLogicVectorConcat && _head,
+    const StdLogicVector & _last) {
+  return StdLogicVectorConcat(move(_head), _last);
 }
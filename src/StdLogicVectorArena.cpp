@@ -0,0 +1,478 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorArena.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Pooled storage for the GMP limbs of StdLogicVectors
+ * @version 0.1
+ *
+ * Each block handed to GMP is preceded by a header of kHeaderSize bytes
+ * holding its size class, or the chunk it has been taken from if it belongs
+ * to an arena. Blocks of the free lists are obtained from malloc() one at a
+ * time, such that a thread which has already released its pools (or any
+ * block exceeding the free lists) simply returns them to the C library.
+ *
+ * The chunks of an arena count their blocks in use plus one reference of the
+ * arena itself. Whoever drops the last reference releases the chunk, which
+ * allows blocks to outlive their arena and to be released by other threads.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <gmp.h>
+
+#include "StdLogicVectorArena.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Pools
+// ****************************************************************************
+// Size of the header preceding each block (keeping the alignment of malloc()).
+static const size_t kHeaderSize = 16;
+// Number of size classes of the free lists, the usable size of class c being
+// (16 << c) bytes (i.e., up to 64 KiB).
+static const size_t kClasses = 13;
+static const size_t kMinClassSize = 16;
+// Bytes kept within the free list of each size class and thread.
+static const size_t kCachedBytes = 1 << 20;
+// Size of the arena chunks, and the number of free chunks kept per thread.
+static const size_t kChunkSize = 64 << 10;
+static const int kCachedChunks = 16;
+
+/**
+ * @brief Header of a block. Blocks of the free lists (and the ones obtained
+ *   from the C library directly, being of class kClasses) have no chunk.
+ */
+struct BlockHeader {
+	void * chunk;
+	size_t sizeClass;
+};
+
+/**
+ * @brief Chunk of an arena, followed by its usable bytes.
+ */
+struct alignas(16) StdLogicVectorArena::Chunk {
+	Chunk * next;
+	atomic<size_t> references;
+	size_t size;
+};
+
+// Indices of the allocation counters.
+enum Counter { kAllocations, kReallocations, kFrees, kPooled, kArena, kSystem,
+	kCounters };
+
+/**
+ * @brief Allocation counters of a thread. Each counter is only written by its
+ *   thread, but may be read by others.
+ */
+struct ThreadCounters {
+	atomic<unsigned long long> values[kCounters];
+	ThreadCounters * next;
+};
+
+// Counters of the running threads and the sums of all terminated ones.
+static mutex gCountersMutex;
+static ThreadCounters * gCounters = NULL;
+static unsigned long long gRetired[kCounters];
+
+static atomic<bool> gInstalled(false);
+
+// States of the pools of a thread.
+enum PoolState { kUnused, kActive, kReleased };
+
+/**
+ * @brief Pools of a thread. The structure is trivial, such that it may still
+ *   be accessed by memory functions called after the thread has released its
+ *   pools (e.g., from the destructors of other thread-local objects).
+ */
+struct ThreadPools {
+	void * free[kClasses];
+	size_t cached[kClasses];
+	StdLogicVectorArena::Chunk * chunks;
+	int chunkCount;
+	ThreadCounters * counters;
+	StdLogicVectorArena * arena;
+	PoolState state;
+};
+
+static thread_local ThreadPools tPools;
+
+/**
+ * @brief Releases the pools of a thread when it terminates.
+ */
+struct ThreadPoolsRelease {
+	~ThreadPoolsRelease();
+};
+
+static thread_local ThreadPoolsRelease tPoolsRelease;
+
+/**
+ * @brief Returns the header of a block.
+ */
+static BlockHeader * HeaderOf(void * _ptr) {
+	return reinterpret_cast<BlockHeader *>(static_cast<char *>(_ptr) -
+			kHeaderSize);
+}
+
+/**
+ * @brief Aborts the program if the C library is out of memory (like the
+ *   default memory functions of GMP).
+ */
+static void * CheckedMalloc(size_t _size) {
+	void * ptr = malloc(_size);
+
+	if ( ptr == NULL ) {
+		fprintf(stderr, "GNU MP: Cannot allocate memory (size=%zu)\n", _size);
+		abort();
+	}
+	return ptr;
+}
+
+/**
+ * @brief Increments an allocation counter of the current thread.
+ */
+static void Count(Counter _counter) {
+	if ( tPools.counters != NULL ) {
+		atomic<unsigned long long> & value = tPools.counters->values[_counter];
+
+		value.store(value.load(memory_order_relaxed) + 1, memory_order_relaxed);
+	}
+}
+
+/**
+ * @brief Sets up the pools of the current thread on its first request.
+ */
+static void ActivatePools() {
+	if ( tPools.state != kUnused ) {
+		return;
+	}
+	ThreadCounters * counters = new ThreadCounters();
+
+	{
+		lock_guard<mutex> lock(gCountersMutex);
+		counters->next = gCounters;
+		gCounters = counters;
+	}
+	tPools.counters = counters;
+	tPools.state = kActive;
+	// Registers the release of the pools at the end of the thread.
+	(void)&tPoolsRelease;
+}
+
+ThreadPoolsRelease::~ThreadPoolsRelease() {
+	for (size_t c = 0; c < kClasses; ++c) {
+		while ( tPools.free[c] != NULL ) {
+			void * block = tPools.free[c];
+
+			tPools.free[c] = *static_cast<void **>(block);
+			free(HeaderOf(block));
+		}
+		tPools.cached[c] = 0;
+	}
+	while ( tPools.chunks != NULL ) {
+		StdLogicVectorArena::Chunk * chunk = tPools.chunks;
+
+		tPools.chunks = chunk->next;
+		chunk->~Chunk();
+		free(chunk);
+	}
+	tPools.chunkCount = 0;
+
+	if ( tPools.counters != NULL ) {
+		lock_guard<mutex> lock(gCountersMutex);
+		ThreadCounters ** link = &gCounters;
+
+		for (int i = 0; i < kCounters; ++i) {
+			gRetired[i] += tPools.counters->values[i].load(memory_order_relaxed);
+		}
+		while ( *link != tPools.counters ) {
+			link = &(*link)->next;
+		}
+		*link = tPools.counters->next;
+		delete tPools.counters;
+		tPools.counters = NULL;
+	}
+	tPools.state = kReleased;
+}
+
+/**
+ * @brief Returns the size class of a block of @p _size bytes (kClasses if it
+ *   exceeds all size classes).
+ */
+static size_t SizeClass(size_t _size) {
+	if ( _size <= kMinClassSize ) {
+		return 0;
+	}
+	return min<size_t>(64 - __builtin_clzll(_size - 1) - 4, kClasses);
+}
+
+/**
+ * @brief Takes a block of at least @p _size bytes from the free lists of the
+ *   current thread, or from the C library.
+ */
+static void * PoolAllocate(size_t _size) {
+	size_t sizeClass = SizeClass(_size);
+	BlockHeader * header;
+
+	if ( sizeClass < kClasses && tPools.free[sizeClass] != NULL ) {
+		void * block = tPools.free[sizeClass];
+
+		tPools.free[sizeClass] = *static_cast<void **>(block);
+		--tPools.cached[sizeClass];
+		Count(kPooled);
+		return block;
+	}
+	if ( sizeClass < kClasses ) {
+		_size = kMinClassSize << sizeClass;
+	}
+	header = static_cast<BlockHeader *>(CheckedMalloc(kHeaderSize + _size));
+	header->chunk = NULL;
+	header->sizeClass = sizeClass;
+	Count(kSystem);
+	return reinterpret_cast<char *>(header) + kHeaderSize;
+}
+
+/**
+ * @brief Releases a block, i.e., puts it onto the free list of its size
+ *   class, drops the reference of its arena chunk or returns it to the C
+ *   library.
+ */
+static void PoolRelease(void * _ptr) {
+	BlockHeader * header = HeaderOf(_ptr);
+	size_t sizeClass = header->sizeClass;
+
+	if ( header->chunk != NULL ) {
+		StdLogicVectorArena::Chunk * chunk =
+				static_cast<StdLogicVectorArena::Chunk *>(header->chunk);
+
+		if ( chunk->references.fetch_sub(1, memory_order_acq_rel) == 1 ) {
+			chunk->~Chunk();
+			free(chunk);
+		}
+	} else if ( sizeClass < kClasses && tPools.state == kActive &&
+			tPools.cached[sizeClass] < (kCachedBytes >> (sizeClass + 4)) ) {
+		*static_cast<void **>(_ptr) = tPools.free[sizeClass];
+		tPools.free[sizeClass] = _ptr;
+		++tPools.cached[sizeClass];
+	} else {
+		free(header);
+	}
+}
+
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+/**
+ * @brief Opens an arena, taking all storage requested by GMP within the
+ *   current thread until the arena is destroyed.
+ */
+StdLogicVectorArena::StdLogicVectorArena() : outer_(tPools.arena),
+		chunks_(NULL), used_(0), bytes_(0)
+{
+	tPools.arena = this;
+}
+
+/**
+ * @brief Closes the arena. Its chunks are recycled, except for the ones
+ *   still holding blocks in use.
+ */
+StdLogicVectorArena::~StdLogicVectorArena() {
+	tPools.arena = outer_;
+	while ( chunks_ != NULL ) {
+		Chunk * chunk = chunks_;
+
+		chunks_ = chunk->next;
+		if ( chunk->references.fetch_sub(1, memory_order_acq_rel) != 1 ) {
+			continue;
+		}
+		if ( chunk->size == kChunkSize && tPools.state == kActive &&
+				tPools.chunkCount < kCachedChunks ) {
+			chunk->next = tPools.chunks;
+			tPools.chunks = chunk;
+			++tPools.chunkCount;
+		} else {
+			chunk->~Chunk();
+			free(chunk);
+		}
+	}
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the number of bytes taken from the arena so far (including
+ *   the block headers).
+ */
+size_t StdLogicVectorArena::getBytes() const {
+	return bytes_;
+}
+
+
+// ****************************************************************************
+// Memory functions
+// ****************************************************************************
+/**
+ * @brief Takes a block from the arena, starting a new chunk if the current
+ *   one is exhausted.
+ */
+void * StdLogicVectorArena::Allocate(size_t _size) {
+	size_t bytes = (kHeaderSize + _size + 15) & ~size_t(15);
+	BlockHeader * header;
+
+	if ( chunks_ == NULL || used_ + bytes > chunks_->size ) {
+		Chunk * chunk;
+
+		if ( bytes <= kChunkSize && tPools.chunks != NULL ) {
+			chunk = tPools.chunks;
+			tPools.chunks = chunk->next;
+			--tPools.chunkCount;
+		} else {
+			size_t size = max(bytes, kChunkSize);
+
+			chunk = new (CheckedMalloc(sizeof(Chunk) + size)) Chunk;
+			chunk->size = size;
+			Count(kSystem);
+		}
+		chunk->references.store(1, memory_order_relaxed);
+		chunk->next = chunks_;
+		chunks_ = chunk;
+		used_ = 0;
+	}
+
+	header = reinterpret_cast<BlockHeader *>(reinterpret_cast<char *>(
+			chunks_ + 1) + used_);
+	header->chunk = chunks_;
+	header->sizeClass = kClasses;
+	chunks_->references.fetch_add(1, memory_order_relaxed);
+	used_  += bytes;
+	bytes_ += bytes;
+	Count(kArena);
+	return reinterpret_cast<char *>(header) + kHeaderSize;
+}
+
+/**
+ * @brief Allocation function installed into GMP.
+ */
+void * StdLogicVectorArena::AllocateFunction(size_t _size) {
+	ActivatePools();
+	Count(kAllocations);
+	if ( tPools.arena != NULL ) {
+		return tPools.arena->Allocate(_size);
+	}
+	return PoolAllocate(_size);
+}
+
+/**
+ * @brief Reallocation function installed into GMP. Blocks of the free lists
+ *   are kept if the new size fits into their size class. Otherwise, blocks
+ *   of an arena are moved into the current arena (if any), while all others
+ *   are moved into the free lists, such that storage outliving an arena does
+ *   not pin its chunks.
+ */
+void * StdLogicVectorArena::ReallocateFunction(void * _ptr, size_t _oldSize,
+		size_t _newSize) {
+	BlockHeader * header = HeaderOf(_ptr);
+	void * result;
+
+	ActivatePools();
+	Count(kReallocations);
+	if ( header->chunk == NULL && header->sizeClass < kClasses &&
+			_newSize <= (kMinClassSize << header->sizeClass) ) {
+		return _ptr;
+	}
+	if ( header->chunk != NULL && tPools.arena != NULL ) {
+		result = tPools.arena->Allocate(_newSize);
+	} else {
+		result = PoolAllocate(_newSize);
+	}
+	memcpy(result, _ptr, min(_oldSize, _newSize));
+	PoolRelease(_ptr);
+	return result;
+}
+
+/**
+ * @brief Release function installed into GMP. The size passed by GMP is not
+ *   needed, since the header of each block records where it came from.
+ */
+void StdLogicVectorArena::FreeFunction(void * _ptr, size_t) {
+	ActivatePools();
+	Count(kFrees);
+	PoolRelease(_ptr);
+}
+
+/**
+ * @brief Installs the pools as the memory functions of GMP. Must be called
+ *   before GMP allocates any storage (i.e., at the start of main()); further
+ *   calls have no effect.
+ */
+void StdLogicVectorArena::Install() {
+	static once_flag installed;
+
+	call_once(installed, []() {
+		mp_set_memory_functions(AllocateFunction, ReallocateFunction,
+				FreeFunction);
+		gInstalled = true;
+	});
+}
+
+/**
+ * @brief Returns whether the pools have been installed into GMP.
+ */
+bool StdLogicVectorArena::isInstalled() {
+	return gInstalled;
+}
+
+/**
+ * @brief Returns the allocation statistics summed over all threads
+ *   (including the terminated ones) since the pools have been installed.
+ */
+StdLogicVectorArena::Statistics StdLogicVectorArena::getStatistics() {
+	unsigned long long values[kCounters];
+	Statistics statistics;
+
+	{
+		lock_guard<mutex> lock(gCountersMutex);
+
+		copy(gRetired, gRetired + kCounters, values);
+		for (ThreadCounters * counters = gCounters; counters != NULL;
+				counters = counters->next) {
+			for (int i = 0; i < kCounters; ++i) {
+				values[i] += counters->values[i].load(memory_order_relaxed);
+			}
+		}
+	}
+	statistics.allocations   = values[kAllocations];
+	statistics.reallocations = values[kReallocations];
+	statistics.frees         = values[kFrees];
+	statistics.pooled        = values[kPooled];
+	statistics.arena         = values[kArena];
+	statistics.system        = values[kSystem];
+	return statistics;
+}
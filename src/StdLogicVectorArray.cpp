@@ -0,0 +1,538 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorArray.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A batch of StdLogicVectors of the same width
+ * @version 0.1
+ *
+ * Operations which are independent of the element boundaries (e.g., the
+ * bitwise AND) are applied to the whole limb buffer with a single kernel call,
+ * while all others loop over the elements. Single-limb elements are handled
+ * by plain loops, which the compiler is free to vectorize across elements.
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <new>
+#include <gmp.h>
+
+#include "StdLogicVectorArray.h"
+#include "StdLogicVectorKernels.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+/**
+ * @brief Creates an empty StdLogicVectorArray.
+ */
+StdLogicVectorArray::StdLogicVectorArray() : limbs_(NULL), count_(0),
+		stride_(0), length_(0)
+{
+}
+
+/**
+ * @brief Creates a StdLogicVectorArray of @p _count elements of @p _length
+ *   bits each, all of them initialized to zero.
+ * @param _count The number of elements.
+ * @param _length The length of each element in bits.
+ */
+StdLogicVectorArray::StdLogicVectorArray(size_t _count, int _length) :
+		count_(_count), length_(max(_length, 0))
+{
+	stride_ = StdLogicVector::LimbsForWidth(length_);
+	limbs_  = Allocate(count_, stride_);
+}
+
+/**
+ * @brief Copy-constructor. Creates a deep copy of all elements.
+ * @param _other The StdLogicVectorArray to be copied.
+ */
+StdLogicVectorArray::StdLogicVectorArray(const StdLogicVectorArray & _other) :
+		count_(_other.count_), stride_(_other.stride_), length_(_other.length_)
+{
+	limbs_ = Allocate(count_, stride_);
+	if ( count_ * stride_ > 0 ) {
+		mpn_copyi(limbs_, _other.limbs_, count_ * stride_);
+	}
+}
+
+/**
+ * @brief Copy-assignment. Reuses the limb buffer if it has the right size.
+ * @param _other The StdLogicVectorArray to be copied.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::operator=(
+		const StdLogicVectorArray & _other) {
+	if ( this != &_other ) {
+		if ( count_ * stride_ != _other.count_ * _other.stride_ ) {
+			// Allocate first, leaving this array intact if that fails.
+			mp_limb_t * limbs = Allocate(_other.count_, _other.stride_);
+
+			free(limbs_);
+			limbs_ = limbs;
+		}
+		count_  = _other.count_;
+		stride_ = _other.stride_;
+		length_ = _other.length_;
+		if ( count_ * stride_ > 0 ) {
+			mpn_copyi(limbs_, _other.limbs_, count_ * stride_);
+		}
+	}
+	return *this;
+}
+
+/**
+ * @brief Move-constructor. Takes over the limb buffer of @p _other, leaving
+ *   it empty.
+ * @param _other The StdLogicVectorArray to be moved.
+ */
+StdLogicVectorArray::StdLogicVectorArray(StdLogicVectorArray && _other)
+		noexcept : limbs_(_other.limbs_), count_(_other.count_),
+		stride_(_other.stride_), length_(_other.length_)
+{
+	_other.limbs_ = NULL;
+	_other.count_ = 0;
+}
+
+/**
+ * @brief Move-assignment. Swaps the limb buffers of both arrays.
+ * @param _other The StdLogicVectorArray to be moved.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::operator=(
+		StdLogicVectorArray && _other) noexcept {
+	swap(limbs_, _other.limbs_);
+	swap(count_, _other.count_);
+	swap(stride_, _other.stride_);
+	swap(length_, _other.length_);
+	return *this;
+}
+
+/**
+ * @brief Destructor. Releases the limb buffer.
+ */
+StdLogicVectorArray::~StdLogicVectorArray() {
+	free(limbs_);
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the number of elements.
+ */
+size_t StdLogicVectorArray::getCount() const {
+	return count_;
+}
+
+/**
+ * @brief Returns the length of the elements in bits.
+ */
+int StdLogicVectorArray::getLength() const {
+	return length_;
+}
+
+/**
+ * @brief Returns the number of limbs occupied by each element.
+ */
+mp_size_t StdLogicVectorArray::getStride() const {
+	return stride_;
+}
+
+/**
+ * @brief Returns the limb buffer holding all elements (element @c i starting
+ *   at limb @c i * getStride()).
+ */
+const mp_limb_t * StdLogicVectorArray::getLimbs() const {
+	return limbs_;
+}
+
+/**
+ * @brief Provides access to a single element.
+ * @param _index The index of the element.
+ * @return A view referring to the bits of the element.
+ */
+StdLogicVectorView StdLogicVectorArray::operator[](size_t _index) {
+	return StdLogicVectorView(limbs_ + _index * stride_, stride_, length_);
+}
+
+/**
+ * @brief Copies a single element into a new StdLogicVector.
+ * @param _index The index of the element.
+ * @return A StdLogicVector of the same length and value as the element.
+ */
+StdLogicVector StdLogicVectorArray::getElement(size_t _index) const {
+	return StdLogicVectorConstView(limbs_ + _index * stride_, stride_,
+			length_).ToStdLogicVector();
+}
+
+
+// ****************************************************************************
+// Bitwise operations
+// ****************************************************************************
+/**
+ * @brief Shift left operation on each element. Bits shifted beyond the length
+ *   of the elements are lost.
+ * @param _bits Number of bits to be shifted to the left.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::ShiftLeft(int _bits) {
+	mp_size_t limbShift = _bits / GMP_NUMB_BITS;
+	unsigned int shift  = _bits % GMP_NUMB_BITS;
+
+	if ( _bits <= 0 || count_ * stride_ == 0 ) {
+		return *this;
+	}
+	if ( _bits >= length_ ) {
+		mpn_zero(limbs_, count_ * stride_);
+		return *this;
+	}
+
+	if ( stride_ == 1 ) {
+		for (size_t i = 0; i < count_; ++i) {
+			limbs_[i] <<= shift;
+		}
+	} else {
+		for (size_t i = 0; i < count_; ++i) {
+			mp_limb_t * element = limbs_ + i * stride_;
+
+			if ( shift != 0 ) {
+				mpn_lshift(element + limbShift, element, stride_ - limbShift, shift);
+			} else {
+				mpn_copyd(element + limbShift, element, stride_ - limbShift);
+			}
+			mpn_zero(element, limbShift);
+		}
+	}
+	MaskElements();
+
+	return *this;
+}
+
+/**
+ * @brief Shift right operation on each element.
+ * @param _bits Number of bits to be shifted to the right.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::ShiftRight(int _bits) {
+	mp_size_t limbShift = _bits / GMP_NUMB_BITS;
+	unsigned int shift  = _bits % GMP_NUMB_BITS;
+
+	if ( _bits <= 0 || count_ * stride_ == 0 ) {
+		return *this;
+	}
+	if ( _bits >= length_ ) {
+		mpn_zero(limbs_, count_ * stride_);
+		return *this;
+	}
+
+	if ( stride_ == 1 ) {
+		for (size_t i = 0; i < count_; ++i) {
+			limbs_[i] >>= shift;
+		}
+	} else {
+		for (size_t i = 0; i < count_; ++i) {
+			mp_limb_t * element = limbs_ + i * stride_;
+
+			if ( shift != 0 ) {
+				mpn_rshift(element, element + limbShift, stride_ - limbShift, shift);
+			} else {
+				mpn_copyi(element, element + limbShift, stride_ - limbShift);
+			}
+			mpn_zero(element + stride_ - limbShift, limbShift);
+		}
+	}
+
+	return *this;
+}
+
+/**
+ * @brief Element-wise bitwise AND operation.
+ * @param _operand The StdLogicVectorArray to perform the AND operation with.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::And(
+		const StdLogicVectorArray & _operand) {
+	if ( Matches(_operand) ) {
+		ActiveBitwiseKernels().And(limbs_, limbs_, _operand.limbs_,
+				count_ * stride_);
+	}
+	return *this;
+}
+
+/**
+ * @brief Element-wise bitwise OR operation.
+ * @param _operand The StdLogicVectorArray to perform the OR operation with.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::Or(
+		const StdLogicVectorArray & _operand) {
+	if ( Matches(_operand) ) {
+		ActiveBitwiseKernels().Or(limbs_, limbs_, _operand.limbs_,
+				count_ * stride_);
+	}
+	return *this;
+}
+
+/**
+ * @brief Element-wise bitwise XOR operation.
+ * @param _operand The StdLogicVectorArray to perform the XOR operation with.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::Xor(
+		const StdLogicVectorArray & _operand) {
+	if ( Matches(_operand) ) {
+		ActiveBitwiseKernels().Xor(limbs_, limbs_, _operand.limbs_,
+				count_ * stride_);
+	}
+	return *this;
+}
+
+/**
+ * @brief Truncates all elements to @p _width bits.
+ * @param _width The new length of the elements (only shorter lengths take
+ *   effect).
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::TruncateAfter(int _width) {
+	if ( _width < length_ ) {
+		length_ = max(_width, 0);
+		MaskElements();
+	}
+	return *this;
+}
+
+
+// ****************************************************************************
+// Arithmetic operations
+// ****************************************************************************
+/**
+ * @brief Element-wise addition. The carries of the elements are truncated.
+ * @param _operand The StdLogicVectorArray to be added.
+ * @return This StdLogicVectorArray.
+ */
+StdLogicVectorArray & StdLogicVectorArray::Add(
+		const StdLogicVectorArray & _operand) {
+	if ( !Matches(_operand) ) {
+		return *this;
+	}
+
+	if ( stride_ == 1 ) {
+		for (size_t i = 0; i < count_; ++i) {
+			limbs_[i] += _operand.limbs_[i];
+		}
+	} else if ( stride_ <= 4 ) {
+		// Narrow elements: propagate the carries inline rather than calling GMP
+		// for each element.
+		for (size_t i = 0; i < count_ * stride_; i += stride_) {
+			mp_limb_t carry = 0;
+
+			for (mp_size_t j = 0; j < stride_; ++j) {
+				mp_limb_t sum = limbs_[i + j] + _operand.limbs_[i + j];
+				mp_limb_t carryOut = (sum < limbs_[i + j]) ? 1 : 0;
+
+				limbs_[i + j] = sum + carry;
+				carry = carryOut | ((limbs_[i + j] < sum) ? 1 : 0);
+			}
+		}
+	} else {
+		for (size_t i = 0; i < count_; ++i) {
+			mpn_add_n(limbs_ + i * stride_, limbs_ + i * stride_,
+					_operand.limbs_ + i * stride_, stride_);
+		}
+	}
+	MaskElements();
+
+	return *this;
+}
+
+
+// ****************************************************************************
+// Comparison
+// ****************************************************************************
+/**
+ * @brief Compares all elements with their expected values, ignoring all bits
+ *   which are not set in the corresponding care masks (see
+ *   StdLogicVector::MatchesWithMask()).
+ *
+ * The limb buffers are scanned in a single pass, skipping the remaining limbs
+ * of an element as soon as it is known to mismatch.
+ *
+ * @param _expected The expected values.
+ * @param _care The care masks, holding a 1 for each bit to be compared.
+ * @return The indices of all mismatching elements in ascending order (empty
+ *   if the arrays do not match in their number and length of elements).
+ */
+vector<size_t> StdLogicVectorArray::FindMismatches(
+		const StdLogicVectorArray & _expected,
+		const StdLogicVectorArray & _care) const {
+	const BitwiseKernels & kernels = ActiveBitwiseKernels();
+	size_t total = count_ * stride_;
+	vector<size_t> mismatches;
+
+	if ( !Matches(_expected) || !Matches(_care) ) {
+		return mismatches;
+	}
+	for (size_t limb = 0; limb < total; ) {
+		limb += kernels.FindMismatch(limbs_ + limb, _expected.limbs_ + limb,
+				_care.limbs_ + limb, total - limb);
+		if ( limb < total ) {
+			mismatches.push_back(limb / stride_);
+			limb = (limb / stride_ + 1) * stride_;
+		}
+	}
+	return mismatches;
+}
+
+
+// ****************************************************************************
+// Bit counting
+// ****************************************************************************
+/**
+ * @brief Counts the bits set in each element (see StdLogicVector::PopCount()).
+ * @return The number of bits set per element.
+ */
+vector<int> StdLogicVectorArray::PopCounts() const {
+	vector<int> counts(count_);
+
+	if ( count_ > 0 ) {
+		ActivePopCountKernels().PopCounts(counts.data(), limbs_, NULL, count_,
+				stride_);
+	}
+	return counts;
+}
+
+/**
+ * @brief Counts the bits in which each element differs from the corresponding
+ *   element of another array (see StdLogicVector::HammingDistance()).
+ * @param _operand The array to compare with.
+ * @return The Hamming distance per element (empty if the arrays do not match
+ *   in their number and length of elements).
+ */
+vector<int> StdLogicVectorArray::HammingDistances(
+		const StdLogicVectorArray & _operand) const {
+	vector<int> distances;
+
+	if ( !Matches(_operand) ) {
+		return distances;
+	}
+	distances.resize(count_);
+	if ( count_ > 0 ) {
+		ActivePopCountKernels().PopCounts(distances.data(), limbs_,
+				_operand.limbs_, count_, stride_);
+	}
+	return distances;
+}
+
+/**
+ * @brief Sums up the Hamming distances of all elements (e.g., the number of
+ *   toggling bits between two batches of states) in a single pass over the
+ *   limb buffers.
+ * @param _operand The array to compare with.
+ * @return The total number of differing bits (zero if the arrays do not match
+ *   in their number and length of elements).
+ */
+mp_bitcnt_t StdLogicVectorArray::HammingDistance(
+		const StdLogicVectorArray & _operand) const {
+	if ( !Matches(_operand) ) {
+		return 0;
+	}
+	return ActivePopCountKernels().PopCount(limbs_, _operand.limbs_,
+			count_ * stride_);
+}
+
+
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+/**
+ * @brief Allocates a zero-initialized, cache-line aligned limb buffer for
+ *   @p _count elements of @p _stride limbs each.
+ * @param _count The number of elements.
+ * @param _stride The number of limbs per element.
+ * @return The limb buffer (NULL for zero limbs).
+ * @throw bad_alloc If the buffer cannot be allocated or its size overflows.
+ */
+mp_limb_t * StdLogicVectorArray::Allocate(size_t _count, mp_size_t _stride) {
+	size_t limbs;
+	size_t bytes;
+	void * buffer;
+
+	if ( _count == 0 || _stride == 0 ) {
+		return NULL;
+	}
+	if ( _count > SIZE_MAX / static_cast<size_t>(_stride) ) {
+		throw bad_alloc();
+	}
+	limbs = _count * static_cast<size_t>(_stride);
+	if ( limbs > (SIZE_MAX - kAlignment) / sizeof(mp_limb_t) ) {
+		throw bad_alloc();
+	}
+	bytes = limbs * sizeof(mp_limb_t);
+	// The size passed to aligned_alloc() must be a multiple of the alignment.
+	bytes  = (bytes + kAlignment - 1) / kAlignment * kAlignment;
+	buffer = aligned_alloc(kAlignment, bytes);
+	if ( buffer == NULL ) {
+		throw bad_alloc();
+	}
+	memset(buffer, 0, bytes);
+	return static_cast<mp_limb_t *>(buffer);
+}
+
+/**
+ * @brief Determines whether another StdLogicVectorArray can be used as an
+ *   operand of an element-wise operation.
+ * @return True if both arrays hold the same number of elements of the same
+ *   length.
+ */
+bool StdLogicVectorArray::Matches(const StdLogicVectorArray & _operand) const {
+	return count_ == _operand.count_ && length_ == _operand.length_ &&
+			stride_ == _operand.stride_;
+}
+
+/**
+ * @brief Clears all bits of all elements beyond the length of the array.
+ */
+void StdLogicVectorArray::MaskElements() {
+	mp_size_t keep   = StdLogicVector::LimbsForWidth(length_);
+	unsigned int rem = length_ % GMP_NUMB_BITS;
+	mp_limb_t mask   = (static_cast<mp_limb_t>(1) << rem) - 1;
+
+	if ( rem == 0 && keep == stride_ ) {
+		return;
+	}
+	for (size_t i = 0; i < count_; ++i) {
+		mp_limb_t * element = limbs_ + i * stride_;
+
+		if ( rem != 0 ) {
+			element[keep - 1] &= mask;
+		}
+		if ( keep < stride_ ) {
+			mpn_zero(element + keep, stride_ - keep);
+		}
+	}
+}
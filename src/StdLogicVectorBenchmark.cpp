@@ -0,0 +1,819 @@
+/******************************************************************************
+ *
+ * Benchmarks for the StdLogicVector class.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorBenchmark.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Benchmarks for the StdLogicVector class
+ * @version 0.1
+ *
+ * This file contains a couple of micro-benchmarks for the StdLogicVector
+ * class. Each benchmark compares the current implementation of an operation
+ * against a reference implementation (usually the former, string-based one)
+ * over a range of vector widths.
+ */
+
+// Macro determining that the following code should only be run when
+// benchmarking the shared library.
+#ifdef BENCHMARK_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <gmp.h>
+
+#include <vector>
+#include "StdLogicVector.h"
+#include "StdLogicVectorArena.h"
+#include "StdLogicVectorArray.h"
+#include "StdLogicVectorBitslice.h"
+#include "StdLogicVectorExpression.h"
+#include "StdLogicVectorLeakage.h"
+#include "StdLogicVectorModContext.h"
+#include "StdLogicVectorPattern.h"
+#include "StdLogicVectorThreadPool.h"
+#include "StdULogicVector.h"
+
+using namespace std;
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+/**
+ * @brief Creates a StdLogicVector of the given width with a random value.
+ */
+static StdLogicVector RandomVector(int _width) {
+	string binary;
+
+	for (int i = 0; i < _width; ++i) {
+		binary.push_back((rand() % 2) ? '1' : '0');
+	}
+	return StdLogicVector(binary, 2, _width);
+}
+
+/**
+ * @brief Runs @p _func @p _iterations times and returns the average runtime
+ *   per call in nanoseconds.
+ */
+template <typename Func>
+static double Measure(int _iterations, Func _func) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	for (int i = 0; i < _iterations; ++i) {
+		_func();
+	}
+	chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+	return elapsed.count() / _iterations;
+}
+
+/**
+ * @brief Prints a single line of a benchmark comparison.
+ */
+static void Report(const char * _name, int _width, double _reference,
+		double _current) {
+	printf("%-20s %8d %14.1f %14.1f %9.1fx\n", _name, _width, _reference,
+			_current, _reference / _current);
+}
+
+
+// ****************************************************************************
+// Reference implementations
+// ****************************************************************************
+/**
+ * @brief The former, string-based implementation of
+ *   StdLogicVector::ReverseBitOrder().
+ */
+static StdLogicVector ReverseBitOrderReference(const StdLogicVector & _input) {
+	string strBinary = _input.ToString(2, true);
+	string reverse = string ( strBinary.rbegin(), strBinary.rend() );
+
+	return StdLogicVector(reverse, 2, _input.getLength());
+}
+
+/**
+ * @brief The former implementation of StdLogicVector::ToString(int, bool).
+ */
+static string ToStringReference(const StdLogicVector & _input, int _base,
+		bool _pad) {
+	double baseLength;
+	string strValue;
+	char * tmp = mpz_get_str(NULL, _base, _input.getValue());
+	string strTmp = tmp;
+
+	free(tmp);
+	baseLength = ceil(_input.getLength() / (log(_base)/log(2)));
+	if (strTmp.length() < baseLength && _pad) {
+		strValue.append(baseLength-strTmp.length(), '0');
+	}
+	strValue.append(strTmp);
+
+	return strValue;
+}
+
+/**
+ * @brief The conversion done by the former string constructor of
+ *   StdLogicVector (i.e., without storing the result).
+ */
+static void ParseReference(string _value, int _base) {
+	mpz_t tmp;
+
+	mpz_init_set_str(tmp, _value.c_str(), _base);
+	mpz_clear(tmp);
+}
+
+/**
+ * @brief The former, string-based implementation of
+ *   StdLogicVector::ToByteArray().
+ */
+static void ToByteArrayReference(const StdLogicVector & _input,
+		unsigned char _byteArray[]) {
+	string hexString = _input.ToString(16, true);
+	int length       = hexString.length();
+	unsigned int n;
+
+	for (int i = 0; i < length; i=i+2) {
+		sscanf(hexString.c_str() + i, "%2X", &n);
+		_byteArray[i/2] = (char)n;
+	}
+}
+
+/**
+ * @brief The former, bit-serial multiplication in GF(2^m) using
+ *   StdLogicVector::TestBit(), StdLogicVector::ShiftLeft() and
+ *   StdLogicVector::Xor().
+ */
+static StdLogicVector GfMulReference(const StdLogicVector & _a,
+		const StdLogicVector & _b, const StdLogicVector & _modulus) {
+	int m = _modulus.getLength() - 1;
+	StdLogicVector a(_a.ToString(16), 16, m + 1);
+	StdLogicVector result(0, m + 1);
+
+	for (int i = m - 1; i >= 0; --i) {
+		result.ShiftLeft(1);
+		if ( result.TestBit(m) ) {
+			result.Xor(_modulus);
+		}
+		if ( _b.TestBit(i) ) {
+			result.Xor(a);
+		}
+	}
+	return result.TruncateAfter(m);
+}
+
+/**
+ * @brief The former emulation of a rotate using two copies,
+ *   StdLogicVector::ShiftLeft(), StdLogicVector::ShiftRight(),
+ *   StdLogicVector::TruncateAfter() and StdLogicVector::Or().
+ */
+static StdLogicVector RotateLeftReference(const StdLogicVector & _input,
+		int _bits) {
+	int length = _input.getLength();
+	StdLogicVector low(_input), high(_input);
+
+	low.ShiftLeft(_bits).TruncateAfter(length);
+	high.ShiftRight(length - _bits);
+	return low.Or(high);
+}
+
+/**
+ * @brief A straightforward trace generator: the Hamming distance of each
+ *   cycle computed on a copy, noise from std::normal_distribution and each
+ *   sample written to the stream on its own.
+ */
+static void LeakageReference(ostream & _os, size_t _traces, int _samples,
+		int _width, double _noise) {
+	for (size_t t = 0; t < _traces; ++t) {
+		mt19937_64 random(t);
+		normal_distribution<double> gaussian(0.0, _noise);
+		StdLogicVector state(static_cast<unsigned long long>(t), _width);
+		StdLogicVector previous(_width);
+
+		for (int i = 0; i < _samples; ++i) {
+			state.RotateLeft(8).Xor(previous);
+			StdLogicVector toggles(previous);
+			float sample = static_cast<float>(
+					toggles.Xor(state).PopCount() + gaussian(random));
+
+			previous = state;
+			_os.write(reinterpret_cast<const char *>(&sample), sizeof(sample));
+		}
+	}
+}
+
+
+// ****************************************************************************
+// Benchmarks
+// ****************************************************************************
+static void BenchmarkReverseBitOrder() {
+	int widths[] = {64, 128, 256, 1024, 4096, 16384};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		int iterations = 20000000 / (widths[i] + 64);
+
+		double reference = Measure(iterations, [&]() {
+			dut = ReverseBitOrderReference(dut);
+		});
+		double current = Measure(iterations, [&]() {
+			dut.ReverseBitOrder();
+		});
+		Report("ReverseBitOrder", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkToBytes() {
+	int widths[] = {64, 128, 256, 1024, 4096, 16384};
+	unsigned char bytes[16384 / 8];
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		int iterations = 20000000 / (widths[i] + 64);
+
+		double reference = Measure(iterations, [&]() {
+			ToByteArrayReference(dut, bytes);
+		});
+		double current = Measure(iterations, [&]() {
+			dut.ToBytes(bytes, sizeof(bytes), StdLogicVector::kBigEndian);
+		});
+		Report("ToBytes", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkFormatTo() {
+	int widths[] = {64, 128, 256, 1024, 4096, 16384};
+	char buf[16384 / 4 + 1];
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		int iterations = 20000000 / (widths[i] + 64);
+
+		double reference = Measure(iterations, [&]() {
+			ToStringReference(dut, 16, true);
+		});
+		double current = Measure(iterations, [&]() {
+			dut.FormatTo(buf, sizeof(buf), 16, true);
+		});
+		Report("FormatTo", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkFromChars() {
+	int widths[] = {64, 128, 256, 1024, 4096, 16384};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		string hex = RandomVector(widths[i]).ToString(16, true);
+		StdLogicVector dut;
+		int iterations = 20000000 / (widths[i] + 64);
+
+		double reference = Measure(iterations, [&]() {
+			ParseReference(hex, 16);
+		});
+		double current = Measure(iterations, [&]() {
+			StdLogicVector::FromChars(hex.data(), hex.data() + hex.size(), 16,
+					widths[i], dut);
+		});
+		Report("FromChars", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkArray() {
+	int widths[] = {64, 128, 256, 1024};
+	const int count = 4096;
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		vector<StdLogicVector> vectors, keys;
+		StdLogicVectorArray array(count, widths[i]), arrayKeys(count, widths[i]);
+		int iterations = 20000 / (widths[i] / 64 + 1);
+
+		for (int j = 0; j < count; ++j) {
+			vectors.push_back(RandomVector(widths[i]));
+			keys.push_back(RandomVector(widths[i]));
+			array[j]     = vectors[j];
+			arrayKeys[j] = keys[j];
+		}
+
+		double reference = Measure(iterations, [&]() {
+			for (int j = 0; j < count; ++j) {
+				vectors[j].Xor(keys[j]).Add(keys[j], true);
+			}
+		});
+		double current = Measure(iterations, [&]() {
+			array.Xor(arrayKeys).Add(arrayKeys);
+		});
+		Report("ArrayXorAdd(4096)", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkBitslice() {
+	int lanes[] = {64, 256, 512};
+	const int width = 64;
+
+	for (unsigned int i = 0; i < sizeof(lanes)/sizeof(lanes[0]); ++i) {
+		vector<StdLogicVector> vectors, keys;
+		StdLogicVectorBitslice slices(width, lanes[i]), sliceKeys(width, lanes[i]);
+		int iterations = 2000000 / lanes[i];
+
+		for (int j = 0; j < lanes[i]; ++j) {
+			vectors.push_back(RandomVector(width));
+			keys.push_back(RandomVector(width));
+			slices.setLane(j, vectors[j]);
+			sliceKeys.setLane(j, keys[j]);
+		}
+
+		double reference = Measure(iterations, [&]() {
+			for (int j = 0; j < lanes[i]; ++j) {
+				vectors[j].Xor(keys[j]).ReverseBitOrder();
+			}
+		});
+		double current = Measure(iterations, [&]() {
+			slices.Xor(sliceKeys).ReverseBitOrder();
+		});
+		Report("BitsliceXorReverse", lanes[i], reference, current);
+	}
+}
+
+static void BenchmarkExpression() {
+	int widths[] = {64, 256, 1024, 4096, 16384};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector a = RandomVector(widths[i]);
+		StdLogicVector b = RandomVector(widths[i]);
+		StdLogicVector c = RandomVector(widths[i]);
+		StdLogicVector dut;
+		int iterations = 20000000 / (widths[i] + 64);
+
+		double reference = Measure(iterations, [&]() {
+			dut = a;
+			dut.Xor(b).And(StdLogicVector(c).ShiftLeft(3));
+		});
+		double current = Measure(iterations, [&]() {
+			dut = And(a ^ b, c << 3);
+		});
+		Report("Expression", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkULogic() {
+	int widths[] = {256, 1024, 4096, 16384, 65536};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		StdLogicVector operand = RandomVector(widths[i]);
+		StdULogicVector uDut(dut), uOperand(operand);
+		int iterations = 200000000 / (widths[i] + 64);
+
+		uOperand.setBit(widths[i] / 2, 'X');
+		// The reference is the two-valued operation.
+		double reference = Measure(iterations, [&]() {
+			dut.And(operand);
+		});
+		double current = Measure(iterations, [&]() {
+			uDut.And(uOperand);
+		});
+		Report("ULogicAnd", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkFindMismatches() {
+	int widths[] = {64, 128, 256, 1024};
+	const int count = 4096;
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		vector<StdLogicVector> actuals;
+		vector<StdLogicVectorPattern> patterns;
+		StdLogicVectorArray actual(count, widths[i]), expected(count, widths[i]);
+		StdLogicVectorArray care(count, widths[i]);
+		size_t found = 0;
+		int iterations = 20000 / (widths[i] / 64 + 1);
+
+		for (int j = 0; j < count; ++j) {
+			StdLogicVector value = RandomVector(widths[i]);
+			StdLogicVector mask  = RandomVector(widths[i]);
+
+			actuals.push_back(value);
+			patterns.push_back(StdLogicVectorPattern(value, mask));
+			actual[j]   = value;
+			expected[j] = patterns[j].getValue();
+			care[j]     = mask;
+		}
+
+		double reference = Measure(iterations, [&]() {
+			for (int j = 0; j < count; ++j) {
+				found += !patterns[j].Matches(actuals[j]);
+			}
+		});
+		double current = Measure(iterations, [&]() {
+			found += actual.FindMismatches(expected, care).size();
+		});
+		Report("FindMismatches(4096)", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkMul() {
+	int widths[] = {64, 128, 256, 512, 1024, 4096};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		// Odd operands keep repeated products modulo 2^width from becoming zero.
+		StdLogicVector dut = RandomVector(widths[i]).Or(StdLogicVector(1, 64));
+		StdLogicVector operand = RandomVector(widths[i]).Or(StdLogicVector(1, 64));
+		int iterations = 20000000 / (widths[i] + 64);
+		mpz_t ref;
+
+		// The reference multiplies the full GMP integers and truncates the
+		// product afterwards.
+		mpz_init_set(ref, dut.getValue());
+		double reference = Measure(iterations, [&]() {
+			mpz_mul(ref, ref, operand.getValue());
+			mpz_fdiv_r_2exp(ref, ref, widths[i]);
+		});
+		double current = Measure(iterations, [&]() {
+			dut.Mul(operand);
+		});
+		mpz_clear(ref);
+		Report("Mul", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkModMul() {
+	int widths[] = {256, 1024, 2048, 4096};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector modulus = RandomVector(widths[i]).Or(StdLogicVector(1, 64));
+		StdLogicVectorModContext ctx(modulus);
+		StdLogicVector dut = ctx.Reduce(RandomVector(widths[i]));
+		StdLogicVector operand = ctx.Reduce(RandomVector(widths[i]));
+		int iterations = 20000000 / (widths[i] + 64);
+		mpz_t ref;
+
+		// The reference reduces each product by a division.
+		mpz_init_set(ref, dut.getValue());
+		double reference = Measure(iterations, [&]() {
+			mpz_mul(ref, ref, operand.getValue());
+			mpz_mod(ref, ref, modulus.getValue());
+		});
+		// The results are written to the existing vector, as in a loop of an
+		// algorithm.
+		double current = Measure(iterations, [&]() {
+			ctx.ModMul(dut, operand, dut);
+		});
+		Report("ModMul", widths[i], reference, current);
+
+		current = Measure(iterations, [&]() {
+			ctx.MontMul(dut, operand, dut);
+		});
+		Report("MontMul", widths[i], reference, current);
+		mpz_clear(ref);
+	}
+}
+
+static void BenchmarkModExp() {
+	int widths[] = {256, 1024, 2048};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector modulus = RandomVector(widths[i]).Or(StdLogicVector(1, 64));
+		StdLogicVectorModContext ctx(modulus);
+		StdLogicVector base = ctx.Reduce(RandomVector(widths[i]));
+		StdLogicVector exponent = RandomVector(widths[i]);
+		StdLogicVector result;
+		int iterations = 2000000000 / widths[i] / widths[i] / widths[i] * 64 + 1;
+		mpz_t ref;
+
+		mpz_init(ref);
+		double reference = Measure(iterations, [&]() {
+			mpz_powm(ref, base.getValue(), exponent.getValue(), modulus.getValue());
+		});
+		double current = Measure(iterations, [&]() {
+			ctx.ModExp(base, exponent, result);
+		});
+		mpz_clear(ref);
+		Report("ModExp", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkClMul() {
+	int widths[] = {64, 128, 256, 1024, 4096, 16384};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector a = RandomVector(widths[i]);
+		StdLogicVector b = RandomVector(widths[i]);
+		int iterations = 20000000 / widths[i] + 1;
+		StdLogicVector result;
+
+		// The reference is the former, bit-serial multiplication using
+		// StdLogicVector::TestBit(), StdLogicVector::ShiftLeft() and
+		// StdLogicVector::Xor().
+		double reference = Measure(max(iterations / 1000, 1), [&]() {
+			StdLogicVector product(0, 2 * widths[i]);
+			StdLogicVector shifted(a.ToString(16), 16, 2 * widths[i]);
+
+			for (int j = 0; j < widths[i]; ++j) {
+				if ( b.TestBit(j) ) {
+					product.Xor(shifted);
+				}
+				shifted.ShiftLeft(1);
+			}
+		});
+		double current = Measure(iterations, [&]() {
+			result = a;
+			result.ClMul(b, false);
+		});
+		Report("ClMul", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkGfMul() {
+	// GCM (GHASH) and NIST B-571.
+	StdLogicVector moduli[] = {
+		StdLogicVector(1, 129).ShiftLeft(128).Xor(StdLogicVector(0x87, 129)),
+		StdLogicVector(1, 572).ShiftLeft(571).Xor(StdLogicVector(0x425, 572)) };
+
+	for (unsigned int i = 0; i < sizeof(moduli)/sizeof(moduli[0]); ++i) {
+		int m = moduli[i].getLength() - 1;
+		StdLogicVector dut = RandomVector(m);
+		StdLogicVector operand = RandomVector(m);
+		int iterations = 200000000 / m / 64 + 1;
+
+		double reference = Measure(iterations / 100 + 1, [&]() {
+			GfMulReference(dut, operand, moduli[i]);
+		});
+		double current = Measure(iterations, [&]() {
+			dut.GfMul(operand, moduli[i]);
+		});
+		Report("GfMul", m, reference, current);
+
+		current = Measure(iterations, [&]() {
+			dut.GfSquare(moduli[i]);
+		});
+		Report("GfSquare", m, reference, current);
+	}
+}
+
+static void BenchmarkRotate() {
+	// ChaCha, SHA-512, a 256-bit state and the Keccak-f[1600] state.
+	int widths[] = {32, 64, 256, 1600};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		int iterations = 20000000 / (widths[i] + 64);
+
+		double reference = Measure(iterations, [&]() {
+			dut = RotateLeftReference(dut, 13);
+		});
+		double current = Measure(iterations, [&]() {
+			dut.RotateLeft(13);
+		});
+		Report("RotateLeft", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkPopCount() {
+	int widths[] = {64, 256, 1024, 4096};
+	const int count = 4096;
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		int iterations = 20000000 / (widths[i] + 64);
+		int bits = 0;
+
+		// The former way of counting the bits set.
+		double reference = Measure(iterations / 100 + 1, [&]() {
+			for (int j = 0; j < widths[i]; ++j) {
+				bits += dut.TestBit(j);
+			}
+		});
+		double current = Measure(iterations, [&]() {
+			bits += dut.PopCount();
+		});
+		Report("PopCount", widths[i], reference, current);
+	}
+
+	// Toggle counting between two batches of states.
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		vector<StdLogicVector> states, next;
+		StdLogicVectorArray array(count, widths[i]), arrayNext(count, widths[i]);
+		int iterations = 20000 / (widths[i] / 64 + 1);
+		mp_bitcnt_t toggles = 0;
+
+		for (int j = 0; j < count; ++j) {
+			states.push_back(RandomVector(widths[i]));
+			next.push_back(RandomVector(widths[i]));
+			array[j]     = states[j];
+			arrayNext[j] = next[j];
+		}
+
+		double reference = Measure(iterations, [&]() {
+			for (int j = 0; j < count; ++j) {
+				toggles += states[j].HammingDistance(next[j]);
+			}
+		});
+		double current = Measure(iterations, [&]() {
+			toggles += array.HammingDistance(arrayNext);
+		});
+		Report("ArrayHamming(4096)", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkLeakage() {
+	int widths[] = {128, 1024};
+	const int samples = 200;
+	const size_t traces = 20000;
+	int threads = max<int>(thread::hardware_concurrency(), 1);
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		ofstream sink("/dev/null", ios::binary);
+		StdLogicVectorLeakage leakage(StdLogicVectorLeakage::kHammingDistance,
+				samples, 2.0);
+		int probe = leakage.AddProbe(StdLogicVector(widths[i]));
+		int width = widths[i];
+		StdLogicVectorLeakage::TraceModel model = [&](size_t _trace,
+				StdLogicVectorLeakage & _leakage) {
+			StdLogicVector state(static_cast<unsigned long long>(_trace), width);
+			StdLogicVector previous(width);
+
+			for (int j = 0; j < samples; ++j) {
+				state.RotateLeft(8).Xor(previous);
+				previous = state;
+				_leakage.Leak(probe, state);
+				_leakage.Clock();
+			}
+		};
+
+		// Runtimes per trace.
+		double reference = Measure(1, [&]() {
+			LeakageReference(sink, traces, samples, width, 2.0);
+		}) / traces;
+		double current = Measure(1, [&]() {
+			leakage.GenerateTraces(sink, traces, 0, StdLogicVectorLeakage::kFloat32,
+					1.0f, 1, model);
+		}) / traces;
+		Report("LeakageTrace", widths[i], reference, current);
+		current = Measure(1, [&]() {
+			leakage.GenerateTraces(sink, traces, 0, StdLogicVectorLeakage::kInt16,
+					100.0f, threads, model);
+		}) / traces;
+		Report("LeakageTrace(MT)", widths[i], reference, current);
+	}
+}
+
+static void BenchmarkXor() {
+	int widths[] = {64, 128, 256, 1024, 4096, 16384, 65536};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		StdLogicVector dut = RandomVector(widths[i]);
+		StdLogicVector operand = RandomVector(widths[i]);
+		int iterations = 200000000 / (widths[i] + 64);
+		mpz_t ref;
+
+		// The former implementation forwarded to mpz_xor().
+		mpz_init_set(ref, dut.getValue());
+		double reference = Measure(iterations, [&]() {
+			mpz_xor(ref, ref, operand.getValue());
+		});
+		double current = Measure(iterations, [&]() {
+			dut.Xor(operand);
+		});
+		mpz_clear(ref);
+		Report("Xor", widths[i], reference, current);
+	}
+}
+
+
+static void BenchmarkParallel() {
+	int widths[] = {128, 1024, 4096};
+	const size_t count = 1 << 16;
+	StdLogicVectorThreadPool single(1);
+	StdLogicVectorThreadPool & pool = StdLogicVectorThreadPool::getDefault();
+	char name[32];
+
+	snprintf(name, sizeof(name), "XorAdd(pool of %d)", pool.getThreadCount());
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		vector<StdLogicVector> a, b, results(count);
+		int iterations = 20000 / widths[i] + 1;
+
+		for (size_t j = 0; j < count; ++j) {
+			a.push_back(RandomVector(widths[i]));
+			b.push_back(RandomVector(widths[i]));
+		}
+		auto xorAdd = [&](size_t _begin, size_t _end) {
+			for (size_t j = _begin; j < _end; ++j) {
+				results[j] = a[j];
+				results[j].Xor(b[j]).Add(a[j], true);
+			}
+		};
+
+		// Runtimes per element.
+		double reference = Measure(iterations, [&]() {
+			xorAdd(0, count);
+		}) / count;
+		double current = Measure(iterations, [&]() {
+			single.ParallelFor(count, 0, xorAdd);
+		}) / count;
+		Report("XorAdd(pool of 1)", widths[i], reference, current);
+		current = Measure(iterations, [&]() {
+			pool.ParallelFor(count, 0, xorAdd);
+		}) / count;
+		Report(name, widths[i], reference, current);
+	}
+}
+
+/**
+ * @brief Measures the runtime of a clock cycle creating a couple of
+ *   temporaries, optionally within an arena.
+ */
+static double MeasureTemporaries(int _width, int _iterations, bool _arena) {
+	StdLogicVector a = RandomVector(_width), b = RandomVector(_width);
+	unsigned long long sink = 0;
+	auto cycle = [&]() {
+		StdLogicVector product(a), sum(b);
+
+		product.Mul(b);
+		sum.Add(a).Xor(product);
+		sink += sum.ToULL();
+	};
+
+	double runtime = Measure(_iterations, [&]() {
+		if ( _arena ) {
+			StdLogicVectorArena scope;
+			cycle();
+		} else {
+			cycle();
+		}
+	});
+	return runtime + (sink == 1 ? 1e-9 : 0.0);
+}
+
+static void BenchmarkArena() {
+	int widths[] = {512, 1024, 4096};
+	const int count = sizeof(widths)/sizeof(widths[0]);
+	double reference[count];
+
+	// The memory functions of GMP can only be replaced once (and before any
+	// storage is allocated), such that this benchmark has to run last.
+	for (int i = 0; i < count; ++i) {
+		reference[i] = MeasureTemporaries(widths[i], 2000000 / widths[i], false);
+	}
+	StdLogicVectorArena::Install();
+	for (int i = 0; i < count; ++i) {
+		Report("Temporaries(pool)", widths[i], reference[i],
+				MeasureTemporaries(widths[i], 2000000 / widths[i], false));
+		Report("Temporaries(arena)", widths[i], reference[i],
+				MeasureTemporaries(widths[i], 2000000 / widths[i], true));
+	}
+}
+
+
+// ****************************************************************************
+// Main function running all benchmarks.
+// ****************************************************************************
+int main() {
+	printf("%-20s %8s %14s %14s %10s\n", "Operation", "Width", "Reference[ns]",
+			"Current[ns]", "Speedup");
+	BenchmarkReverseBitOrder();
+	BenchmarkToBytes();
+	BenchmarkFormatTo();
+	BenchmarkFromChars();
+	BenchmarkArray();
+	BenchmarkBitslice();
+	BenchmarkExpression();
+	BenchmarkULogic();
+	BenchmarkFindMismatches();
+	BenchmarkMul();
+	BenchmarkModMul();
+	BenchmarkModExp();
+	BenchmarkClMul();
+	BenchmarkGfMul();
+	BenchmarkRotate();
+	BenchmarkPopCount();
+	BenchmarkLeakage();
+	BenchmarkXor();
+	BenchmarkParallel();
+	BenchmarkArena();
+	return 0;
+}
+
+#endif /* BENCHMARK_ */
@@ -0,0 +1,388 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorBitslice.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A bitsliced batch of StdLogicVectors
+ * @version 0.1
+ *
+ * The slices are kept as the elements of a StdLogicVectorArray, such that the
+ * bitwise operations use the vectorized kernels of the array. Converting
+ * between the normal and the bitsliced form transposes 64x64-bit blocks.
+ */
+#include <algorithm>
+#include <gmp.h>
+
+#include "StdLogicVectorBitslice.h"
+
+using namespace std;
+
+static_assert(GMP_NUMB_BITS == 64, "Bitslicing requires 64-bit limbs.");
+
+
+// ****************************************************************************
+// Kernels
+// ****************************************************************************
+/**
+ * @brief Transposes a 64x64 bit matrix in place, i.e., bit @c j of row @c i
+ *   is moved to bit @c i of row @c j.
+ *
+ * The matrix is transposed recursively by swapping the off-diagonal blocks
+ * of 32x32, 16x16, ..., 1x1 bits, using six rounds of masked shifts.
+ */
+static void Transpose64(mp_limb_t _rows[64]) {
+  mp_limb_t mask = 0x00000000FFFFFFFFull;
+
+  for (int width = 32; width != 0; width >>= 1, mask ^= mask << width) {
+    for (int i = 0; i < 64; i = ((i | width) + 1) & ~width) {
+      mp_limb_t swap = ((_rows[i] >> width) ^ _rows[i | width]) & mask;
+
+      _rows[i]         ^= swap << width;
+      _rows[i | width] ^= swap;
+    }
+  }
+}
+
+
+// ****************************************************************************
+// Constructors
+// ****************************************************************************
+/**
+ * @brief Creates an empty StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice::StdLogicVectorBitslice()
+{
+}
+
+/**
+ * @brief Creates a StdLogicVectorBitslice holding @p _lanes instances of a
+ *   @p _length bit vector, all of them initialized to zero.
+ * @param _length The length of each instance in bits.
+ * @param _lanes The number of instances (rounded up to a multiple of 64).
+ */
+StdLogicVectorBitslice::StdLogicVectorBitslice(int _length, int _lanes) :
+		slices_(max(_length, 0), (max(_lanes, 1) + 63) / 64 * 64)
+{
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the length of the instances in bits (i.e., the number of
+ *   slices).
+ */
+int StdLogicVectorBitslice::getLength() const {
+	return slices_.getCount();
+}
+
+/**
+ * @brief Returns the number of instances (i.e., the number of bits per
+ *   slice).
+ */
+int StdLogicVectorBitslice::getLanes() const {
+	return slices_.getLength();
+}
+
+/**
+ * @brief Provides access to a single slice.
+ * @param _index The index of the bit the slice holds.
+ * @return A view onto bit @p _index of all instances (lane @c j holding the
+ *   bit of instance @c j).
+ */
+StdLogicVectorView StdLogicVectorBitslice::Slice(int _index) {
+	return slices_[_index];
+}
+
+/**
+ * @brief Extracts a single instance.
+ * @param _lane The index of the instance.
+ * @return A StdLogicVector of the length of the bitslice holding the value of
+ *   the instance.
+ */
+StdLogicVector StdLogicVectorBitslice::getLane(int _lane) const {
+	StdLogicVector result(getLength());
+	mp_size_t size    = StdLogicVector::LimbsForWidth(getLength());
+	mp_limb_t * limbs = result.ModifyLimbs(size);
+
+	for (int i = 0; i < getLength(); ++i) {
+		limbs[i / 64] |= ((SliceLimbs(i)[_lane / 64] >> (_lane % 64)) & 1) <<
+				(i % 64);
+	}
+	result.FinishLimbs(size);
+
+	return result;
+}
+
+/**
+ * @brief Assigns the value of a single instance.
+ * @param _lane The index of the instance.
+ * @param _value The new value of the instance (truncated to the length of the
+ *   bitslice).
+ */
+void StdLogicVectorBitslice::setLane(int _lane, const StdLogicVector & _value) {
+	const mp_limb_t * limbs = mpz_limbs_read(_value.getValue());
+	mp_size_t size = mpz_size(_value.getValue());
+	mp_limb_t bit  = static_cast<mp_limb_t>(1) << (_lane % 64);
+
+	for (int i = 0; i < getLength(); ++i) {
+		mp_limb_t * slice = SliceLimbs(i) + _lane / 64;
+
+		if ( i / 64 < size && ((limbs[i / 64] >> (i % 64)) & 1) ) {
+			*slice |= bit;
+		} else {
+			*slice &= ~bit;
+		}
+	}
+}
+
+
+// ****************************************************************************
+// Transposition
+// ****************************************************************************
+/**
+ * @brief Transposes a batch of vectors into bitsliced form.
+ * @param _inputs The vectors, element @c j becoming instance @c j.
+ * @return A StdLogicVectorBitslice with as many lanes as @p _inputs has
+ *   elements (rounded up to a multiple of 64). Unused lanes are zero.
+ */
+StdLogicVectorBitslice StdLogicVectorBitslice::FromArray(
+		const StdLogicVectorArray & _inputs) {
+	StdLogicVectorBitslice result(_inputs.getLength(), _inputs.getCount());
+	mp_size_t stride = _inputs.getStride();
+	mp_size_t blocks = result.getLanes() / 64;
+	mp_limb_t rows[64];
+
+	for (mp_size_t block = 0; block < blocks; ++block) {
+		for (mp_size_t chunk = 0; chunk < stride; ++chunk) {
+			// Gather 64 bits of 64 instances, ...
+			for (size_t j = 0; j < 64; ++j) {
+				size_t element = block * 64 + j;
+				rows[j] = (element < _inputs.getCount()) ?
+						_inputs.getLimbs()[element * stride + chunk] : 0;
+			}
+			// ... and scatter them to 64 slices.
+			Transpose64(rows);
+			for (int k = 0; k < 64 && chunk * 64 + k < result.getLength(); ++k) {
+				result.SliceLimbs(chunk * 64 + k)[block] = rows[k];
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Transposes the bitsliced instances back into a batch of vectors.
+ * @return A StdLogicVectorArray holding one element per lane.
+ */
+StdLogicVectorArray StdLogicVectorBitslice::ToArray() const {
+	StdLogicVectorArray result(getLanes(), getLength());
+	mp_size_t stride = result.getStride();
+	mp_size_t blocks = getLanes() / 64;
+	mp_limb_t rows[64];
+
+	for (mp_size_t block = 0; block < blocks; ++block) {
+		for (mp_size_t chunk = 0; chunk < stride; ++chunk) {
+			for (int k = 0; k < 64; ++k) {
+				rows[k] = (chunk * 64 + k < getLength()) ?
+						SliceLimbs(chunk * 64 + k)[block] : 0;
+			}
+			Transpose64(rows);
+			for (size_t j = 0; j < 64; ++j) {
+				result.limbs_[(block * 64 + j) * stride + chunk] = rows[j];
+			}
+		}
+	}
+
+	return result;
+}
+
+
+// ****************************************************************************
+// Bitwise operations
+// ****************************************************************************
+/**
+ * @brief Shift left operation on all instances (i.e., moving each slice
+ *   @p _bits slices up). Bits shifted beyond the length are lost.
+ * @param _bits Number of bits to be shifted to the left.
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::ShiftLeft(int _bits) {
+	mp_size_t stride = slices_.getStride();
+	int bits = min(max(_bits, 0), getLength());
+
+	if ( bits > 0 && bits < getLength() ) {
+		mpn_copyd(SliceLimbs(bits), SliceLimbs(0), (getLength() - bits) * stride);
+	}
+	if ( bits > 0 ) {
+		mpn_zero(SliceLimbs(0), bits * stride);
+	}
+	return *this;
+}
+
+/**
+ * @brief Shift right operation on all instances (i.e., moving each slice
+ *   @p _bits slices down).
+ * @param _bits Number of bits to be shifted to the right.
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::ShiftRight(int _bits) {
+	mp_size_t stride = slices_.getStride();
+	int bits = min(max(_bits, 0), getLength());
+
+	if ( bits > 0 && bits < getLength() ) {
+		mpn_copyi(SliceLimbs(0), SliceLimbs(bits), (getLength() - bits) * stride);
+	}
+	if ( bits > 0 ) {
+		mpn_zero(SliceLimbs(getLength() - bits), bits * stride);
+	}
+	return *this;
+}
+
+/**
+ * @brief Bitwise AND operation on all instances.
+ * @param _operand The StdLogicVectorBitslice to perform the AND operation
+ *   with (of the same length and number of lanes).
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::And(
+		const StdLogicVectorBitslice & _operand) {
+	slices_.And(_operand.slices_);
+	return *this;
+}
+
+/**
+ * @brief Bitwise OR operation on all instances.
+ * @param _operand The StdLogicVectorBitslice to perform the OR operation with
+ *   (of the same length and number of lanes).
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::Or(
+		const StdLogicVectorBitslice & _operand) {
+	slices_.Or(_operand.slices_);
+	return *this;
+}
+
+/**
+ * @brief Bitwise XOR operation on all instances.
+ * @param _operand The StdLogicVectorBitslice to perform the XOR operation
+ *   with (of the same length and number of lanes).
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::Xor(
+		const StdLogicVectorBitslice & _operand) {
+	slices_.Xor(_operand.slices_);
+	return *this;
+}
+
+/**
+ * @brief Truncates all instances to @p _width bits by dropping the upper
+ *   slices.
+ * @param _width The new length (only shorter lengths take effect).
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::TruncateAfter(int _width) {
+	if ( _width < getLength() ) {
+		slices_.count_ = max(_width, 0);
+	}
+	return *this;
+}
+
+/**
+ * @brief Replaces a number of bits of all instances with those of another
+ *   StdLogicVectorBitslice (see StdLogicVector::ReplaceBits()).
+ * @param _begin The 0-based index of the first bit to be replaced.
+ * @param _input The replacement (with the same number of lanes). Bits beyond
+ *   the length of this bitslice are ignored.
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::ReplaceBits(int _begin,
+		const StdLogicVectorBitslice & _input) {
+	int width;
+
+	_begin = max(_begin, 0);
+	width  = min(_input.getLength(), getLength() - _begin);
+	if ( width <= 0 || _input.getLanes() != getLanes() ) {
+		return *this;
+	}
+	if ( &_input == this ) {
+		return ReplaceBits(_begin, StdLogicVectorBitslice(_input));
+	}
+	mpn_copyi(SliceLimbs(_begin), _input.SliceLimbs(0),
+			width * slices_.getStride());
+
+	return *this;
+}
+
+/**
+ * @brief Extracts a range of bits of all instances.
+ * @param _hi The 0-based index of the most significant bit to be extracted.
+ * @param _lo The 0-based index of the least significant bit to be extracted.
+ * @return A new StdLogicVectorBitslice of length @p _hi - @p _lo + 1 holding
+ *   the extracted bits (bits beyond the length are zero).
+ */
+StdLogicVectorBitslice StdLogicVectorBitslice::Extract(int _hi, int _lo) const {
+	int lo    = max(_lo, 0);
+	int width = max(_hi - lo + 1, 0);
+	int valid = max(min(width, getLength() - lo), 0);
+	StdLogicVectorBitslice result(width, getLanes());
+
+	if ( valid > 0 ) {
+		mpn_copyi(result.SliceLimbs(0), SliceLimbs(lo),
+				valid * slices_.getStride());
+	}
+	return result;
+}
+
+/**
+ * @brief Reverses the bit order of all instances by reversing the order of
+ *   the slices.
+ * @return This StdLogicVectorBitslice.
+ */
+StdLogicVectorBitslice & StdLogicVectorBitslice::ReverseBitOrder() {
+	mp_size_t stride = slices_.getStride();
+
+	for (int lo = 0, hi = getLength() - 1; lo < hi; ++lo, --hi) {
+		swap_ranges(SliceLimbs(lo), SliceLimbs(lo) + stride, SliceLimbs(hi));
+	}
+	return *this;
+}
+
+
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+/**
+ * @brief Returns the limbs of a single slice.
+ */
+mp_limb_t * StdLogicVectorBitslice::SliceLimbs(int _index) {
+	return slices_.limbs_ + _index * slices_.getStride();
+}
+
+/**
+ * @copydoc SliceLimbs(int)
+ */
+const mp_limb_t * StdLogicVectorBitslice::SliceLimbs(int _index) const {
+	return slices_.limbs_ + _index * slices_.getStride();
+}
@@ -0,0 +1,1488 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorKernels.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Limb kernels selected at runtime for the host CPU
+ * @version 0.1
+ *
+ * The vectorized kernels are compiled for their instruction set using
+ * function attributes, such that the library itself may be built for the
+ * baseline architecture. They are only called once the CPU has been checked to
+ * support them.
+ */
+#include <algorithm>
+#include <vector>
+#include <gmp.h>
+#if defined(__x86_64__) && GMP_NUMB_BITS == 64
+#include <immintrin.h>
+#define STDLOGICVECTOR_X86_KERNELS_
+#endif
+
+#include "StdLogicVectorKernels.h"
+
+using namespace std;
+
+
+// ****************************************************************************
+// Portable kernels
+// ****************************************************************************
+static void AndPortable(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b, mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    _dst[i] = _a[i] & _b[i];
+  }
+}
+
+static void OrPortable(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b, mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    _dst[i] = _a[i] | _b[i];
+  }
+}
+
+static void XorPortable(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b, mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    _dst[i] = _a[i] ^ _b[i];
+  }
+}
+
+static mp_size_t FindMismatchPortable(const mp_limb_t * _a,
+    const mp_limb_t * _b, const mp_limb_t * _care, mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    if ( ((_a[i] ^ _b[i]) & _care[i]) != 0 ) {
+      return i;
+    }
+  }
+  return _n;
+}
+
+static const BitwiseKernels kPortableKernels = {
+  "portable", AndPortable, OrPortable, XorPortable, FindMismatchPortable
+};
+
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+// ****************************************************************************
+// AVX2 kernels
+// ****************************************************************************
+// Processes four limbs per iteration and the remaining ones individually.
+#define AVX2_KERNEL(name, op, vecOp)                                           \
+  __attribute__((target("avx2")))                                              \
+  static void name(mp_limb_t * _dst, const mp_limb_t * _a,                     \
+      const mp_limb_t * _b, mp_size_t _n) {                                    \
+    mp_size_t i = 0;                                                           \
+    for (; i + 4 <= _n; i += 4) {                                              \
+      __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_a + i)); \
+      __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_b + i)); \
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(_dst + i), vecOp(a, b)); \
+    }                                                                          \
+    for (; i < _n; ++i) {                                                      \
+      _dst[i] = _a[i] op _b[i];                                                \
+    }                                                                          \
+  }
+
+AVX2_KERNEL(AndAvx2, &, _mm256_and_si256)
+AVX2_KERNEL(OrAvx2, |, _mm256_or_si256)
+AVX2_KERNEL(XorAvx2, ^, _mm256_xor_si256)
+#undef AVX2_KERNEL
+
+// Tests four limbs per iteration and locates a mismatch within them using the
+// portable kernel.
+__attribute__((target("avx2")))
+static mp_size_t FindMismatchAvx2(const mp_limb_t * _a, const mp_limb_t * _b,
+    const mp_limb_t * _care, mp_size_t _n) {
+  mp_size_t i = 0;
+  for (; i + 4 <= _n; i += 4) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_a + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_b + i));
+    __m256i care = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i *>(_care + i));
+    if ( !_mm256_testz_si256(_mm256_xor_si256(a, b), care) ) {
+      break;
+    }
+  }
+  return i + FindMismatchPortable(_a + i, _b + i, _care + i, _n - i);
+}
+
+static const BitwiseKernels kAvx2Kernels = {
+  "avx2", AndAvx2, OrAvx2, XorAvx2, FindMismatchAvx2
+};
+
+
+// ****************************************************************************
+// AVX-512 kernels
+// ****************************************************************************
+// Processes eight limbs per iteration and the remaining ones using a masked
+// load and store.
+#define AVX512_KERNEL(name, vecOp)                                             \
+  __attribute__((target("avx512f")))                                           \
+  static void name(mp_limb_t * _dst, const mp_limb_t * _a,                     \
+      const mp_limb_t * _b, mp_size_t _n) {                                    \
+    mp_size_t i = 0;                                                           \
+    for (; i + 8 <= _n; i += 8) {                                              \
+      __m512i a = _mm512_loadu_si512(_a + i);                                  \
+      __m512i b = _mm512_loadu_si512(_b + i);                                  \
+      _mm512_storeu_si512(_dst + i, vecOp(a, b));                              \
+    }                                                                          \
+    if ( i < _n ) {                                                            \
+      __mmask8 mask = static_cast<__mmask8>((1u << (_n - i)) - 1);             \
+      __m512i a = _mm512_maskz_loadu_epi64(mask, _a + i);                      \
+      __m512i b = _mm512_maskz_loadu_epi64(mask, _b + i);                      \
+      _mm512_mask_storeu_epi64(_dst + i, mask, vecOp(a, b));                   \
+    }                                                                          \
+  }
+
+AVX512_KERNEL(AndAvx512, _mm512_and_si512)
+AVX512_KERNEL(OrAvx512, _mm512_or_si512)
+AVX512_KERNEL(XorAvx512, _mm512_xor_si512)
+#undef AVX512_KERNEL
+
+// Tests eight limbs per iteration (the remaining ones using a masked load),
+// yielding the index of a mismatch directly from the test mask.
+__attribute__((target("avx512f")))
+static mp_size_t FindMismatchAvx512(const mp_limb_t * _a, const mp_limb_t * _b,
+    const mp_limb_t * _care, mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; i += 8) {
+    __mmask8 mask = (_n - i >= 8) ? 0xFF :
+        static_cast<__mmask8>((1u << (_n - i)) - 1);
+    __m512i a    = _mm512_maskz_loadu_epi64(mask, _a + i);
+    __m512i b    = _mm512_maskz_loadu_epi64(mask, _b + i);
+    __m512i care = _mm512_maskz_loadu_epi64(mask, _care + i);
+    __mmask8 mismatch = _mm512_test_epi64_mask(_mm512_xor_si512(a, b), care);
+    if ( mismatch != 0 ) {
+      return i + __builtin_ctz(mismatch);
+    }
+  }
+  return _n;
+}
+
+static const BitwiseKernels kAvx512Kernels = {
+  "avx512f", AndAvx512, OrAvx512, XorAvx512, FindMismatchAvx512
+};
+#endif /* STDLOGICVECTOR_X86_KERNELS_ */
+
+
+// ****************************************************************************
+// Nine-valued logic kernels
+// ****************************************************************************
+// The four planes of a block of bits, where V is either a single limb or a
+// vector of limbs.
+template <typename V>
+struct ULogicPlanes {
+  V value;
+  V unknown;
+  V weak;
+  V special;
+};
+
+// The operations of the IEEE 1164 tables (see StdULogicVector.cpp for the
+// tables themselves). Any U yields U, which is why most operations track the
+// uninitialized bits separately.
+struct ULogicAndOp {
+  template <typename V>
+  static inline __attribute__((always_inline)) void Apply(
+      ULogicPlanes<V> & _a, const ULogicPlanes<V> & _b) {
+    V zero = (~_a.unknown & ~_a.value) | (~_b.unknown & ~_b.value);
+    V u    = (_a.unknown & _a.special & ~_a.weak) |
+        (_b.unknown & _b.special & ~_b.weak);
+
+    _a.value   = ~_a.unknown & _a.value & ~_b.unknown & _b.value;
+    _a.unknown = ~zero & (_a.unknown | _b.unknown);
+    _a.weak    = V();
+    _a.special = ~zero & u;
+  }
+};
+
+struct ULogicOrOp {
+  template <typename V>
+  static inline __attribute__((always_inline)) void Apply(
+      ULogicPlanes<V> & _a, const ULogicPlanes<V> & _b) {
+    V one = (~_a.unknown & _a.value) | (~_b.unknown & _b.value);
+    V u   = (_a.unknown & _a.special & ~_a.weak) |
+        (_b.unknown & _b.special & ~_b.weak);
+
+    _a.value   = one;
+    _a.unknown = ~one & (_a.unknown | _b.unknown);
+    _a.weak    = V();
+    _a.special = ~one & u;
+  }
+};
+
+struct ULogicXorOp {
+  template <typename V>
+  static inline __attribute__((always_inline)) void Apply(
+      ULogicPlanes<V> & _a, const ULogicPlanes<V> & _b) {
+    V unknown = _a.unknown | _b.unknown;
+
+    _a.special = (_a.unknown & _a.special & ~_a.weak) |
+        (_b.unknown & _b.special & ~_b.weak);
+    _a.value   = ~unknown & (_a.value ^ _b.value);
+    _a.unknown = unknown;
+    _a.weak    = V();
+  }
+};
+
+struct ULogicResolveOp {
+  template <typename V>
+  static inline __attribute__((always_inline)) void Apply(
+      ULogicPlanes<V> & _a, const ULogicPlanes<V> & _b) {
+    V uA      = _a.unknown & _a.special & ~_a.weak;
+    V uB      = _b.unknown & _b.special & ~_b.weak;
+    V strongA = ~_a.weak & ~uA;
+    V strongB = ~_b.weak & ~uB;
+    V zA      = _a.unknown & _a.weak & _a.special;
+    V zB      = _b.unknown & _b.weak & _b.special;
+    V agree   = ~_a.unknown & ~_b.unknown & ~(_a.value ^ _b.value);
+    V u       = uA | uB;
+    // Bits where only one of the drivers determines the result (i.e., the
+    // stronger one, or the one not being Z).
+    V onlyA = (strongA & ~strongB) | (~strongA & ~strongB & zB & ~zA);
+    V onlyB = (strongB & ~strongA) | (~strongA & ~strongB & zA & ~zB);
+    V both  = ~onlyA & ~onlyB;
+
+    // A single strong '-' becomes X, hence the value is only kept if known.
+    _a.value   = ~u & ((both & agree & _a.value) |
+        (onlyA & ~_a.unknown & _a.value) | (onlyB & ~_b.unknown & _b.value));
+    _a.unknown = u | (both & ~agree) | (onlyA & _a.unknown) |
+        (onlyB & _b.unknown);
+    _a.weak    = ~u & ((both & _a.weak) | (onlyA & _a.weak) |
+        (onlyB & _b.weak));
+    _a.special = u | (both & zA & zB);
+  }
+};
+
+struct ULogicNotOp {
+  template <typename V>
+  static inline __attribute__((always_inline)) void Apply(
+      ULogicPlanes<V> & _a, const ULogicPlanes<V> &) {
+    _a.special = _a.unknown & _a.special & ~_a.weak;
+    _a.value   = ~_a.unknown & ~_a.value;
+    _a.weak    = V();
+  }
+};
+
+/**
+ * @brief Applies an operation to all blocks of the planes, one vector @p V of
+ *   limbs per plane at a time. If @p _b is NULL, @p _a is passed twice.
+ */
+template <typename V, typename Op>
+static inline __attribute__((always_inline)) void ULogicLoop(mp_limb_t * _a,
+    const mp_limb_t * _b, mp_size_t _stride) {
+  const mp_size_t kLimbs = sizeof(V) / sizeof(mp_limb_t);
+  mp_size_t stride = _stride / kLimbs;
+  V * a = reinterpret_cast<V *>(_a);
+  const V * b = reinterpret_cast<const V *>(_b ? _b : _a);
+
+  for (mp_size_t i = 0; i < stride; ++i) {
+    ULogicPlanes<V> planesA = {
+      a[i], a[stride + i], a[2 * stride + i], a[3 * stride + i]
+    };
+    ULogicPlanes<V> planesB = {
+      b[i], b[stride + i], b[2 * stride + i], b[3 * stride + i]
+    };
+
+    Op::Apply(planesA, planesB);
+    a[i]              = planesA.value;
+    a[stride + i]     = planesA.unknown;
+    a[2 * stride + i] = planesA.weak;
+    a[3 * stride + i] = planesA.special;
+  }
+}
+
+// Defines a complete set of kernels working on vectors of type V.
+#define ULOGIC_KERNELS(suffix, attributes, V)                                  \
+  attributes static void ULogicAnd##suffix(mp_limb_t * _a,                     \
+      const mp_limb_t * _b, mp_size_t _stride) {                               \
+    ULogicLoop<V, ULogicAndOp>(_a, _b, _stride);                               \
+  }                                                                            \
+  attributes static void ULogicOr##suffix(mp_limb_t * _a,                      \
+      const mp_limb_t * _b, mp_size_t _stride) {                               \
+    ULogicLoop<V, ULogicOrOp>(_a, _b, _stride);                                \
+  }                                                                            \
+  attributes static void ULogicXor##suffix(mp_limb_t * _a,                     \
+      const mp_limb_t * _b, mp_size_t _stride) {                               \
+    ULogicLoop<V, ULogicXorOp>(_a, _b, _stride);                               \
+  }                                                                            \
+  attributes static void ULogicResolve##suffix(mp_limb_t * _a,                 \
+      const mp_limb_t * _b, mp_size_t _stride) {                               \
+    ULogicLoop<V, ULogicResolveOp>(_a, _b, _stride);                           \
+  }                                                                            \
+  attributes static void ULogicNot##suffix(mp_limb_t * _a,                     \
+      mp_size_t _stride) {                                                     \
+    ULogicLoop<V, ULogicNotOp>(_a, NULL, _stride);                             \
+  }
+
+ULOGIC_KERNELS(Portable, , mp_limb_t)
+
+static const ULogicKernels kPortableULogicKernels = {
+  "portable", ULogicAndPortable, ULogicOrPortable, ULogicXorPortable,
+  ULogicResolvePortable, ULogicNotPortable
+};
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+// The vectors are GCC vector extensions, which map the bitwise operators onto
+// the instructions of the respective target.
+typedef mp_limb_t ULogicVector4 __attribute__((vector_size(32)));
+typedef mp_limb_t ULogicVector8 __attribute__((vector_size(64)));
+
+ULOGIC_KERNELS(Avx2, __attribute__((target("avx2"))), ULogicVector4)
+ULOGIC_KERNELS(Avx512, __attribute__((target("avx512f"))), ULogicVector8)
+
+static const ULogicKernels kAvx2ULogicKernels = {
+  "avx2", ULogicAndAvx2, ULogicOrAvx2, ULogicXorAvx2, ULogicResolveAvx2,
+  ULogicNotAvx2
+};
+
+static const ULogicKernels kAvx512ULogicKernels = {
+  "avx512f", ULogicAndAvx512, ULogicOrAvx512, ULogicXorAvx512,
+  ULogicResolveAvx512, ULogicNotAvx512
+};
+#endif /* STDLOGICVECTOR_X86_KERNELS_ */
+#undef ULOGIC_KERNELS
+
+
+// ****************************************************************************
+// Carry-less multiplication kernels
+// ****************************************************************************
+// The multiples 0 to 15 of a limb whose three most significant bits are
+// cleared, such that none of the multiples overflows.
+static inline void ClMulTable(mp_limb_t _b, mp_limb_t _table[16]) {
+  _table[0] = 0;
+  _table[1] = _b & (~static_cast<mp_limb_t>(0) >> 3);
+  for (int i = 2; i < 16; i += 2) {
+    _table[i]     = _table[i / 2] << 1;
+    _table[i + 1] = _table[i] ^ _table[1];
+  }
+}
+
+// Multiplies a limb with the limb _b of a table (see ClMulTable()), four bits
+// of _a at a time. The three most significant bits of _b are added
+// separately.
+static inline void ClMulLimb(mp_limb_t _a, mp_limb_t _b,
+    const mp_limb_t _table[16], mp_limb_t & _lo, mp_limb_t & _hi) {
+  mp_limb_t lo = _table[_a >> (GMP_NUMB_BITS - 4)];
+  mp_limb_t hi = 0;
+
+  for (int shift = GMP_NUMB_BITS - 8; shift >= 0; shift -= 4) {
+    hi = (hi << 4) | (lo >> (GMP_NUMB_BITS - 4));
+    lo = (lo << 4) ^ _table[(_a >> shift) & 15];
+  }
+  for (int k = GMP_NUMB_BITS - 3; k < GMP_NUMB_BITS; ++k) {
+    mp_limb_t mask = -((_b >> k) & 1);
+    lo ^= (_a << k) & mask;
+    hi ^= (_a >> (GMP_NUMB_BITS - k)) & mask;
+  }
+  _lo = lo;
+  _hi = hi;
+}
+
+static void ClMulPortable(mp_limb_t * _dst, const mp_limb_t * _a,
+    mp_size_t _an, const mp_limb_t * _b, mp_size_t _bn) {
+  mp_limb_t table[16];
+  mp_limb_t lo, hi;
+
+  mpn_zero(_dst, _an + _bn);
+  for (mp_size_t j = 0; j < _bn; ++j) {
+    ClMulTable(_b[j], table);
+    for (mp_size_t i = 0; i < _an; ++i) {
+      ClMulLimb(_a[i], _b[j], table, lo, hi);
+      _dst[i + j]     ^= lo;
+      _dst[i + j + 1] ^= hi;
+    }
+  }
+}
+
+static const ClMulKernels kPortableClMulKernels = {
+  "portable", ClMulPortable
+};
+
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+// Multiplies two limbs of _a per instruction. The upper half of the product
+// of the odd limb is carried into the next pair of limbs.
+__attribute__((target("pclmul,sse4.1")))
+static void ClMulPclmul(mp_limb_t * _dst, const mp_limb_t * _a,
+    mp_size_t _an, const mp_limb_t * _b, mp_size_t _bn) {
+  mpn_zero(_dst, _an + _bn);
+  for (mp_size_t j = 0; j < _bn; ++j) {
+    __m128i b = _mm_cvtsi64_si128(_b[j]);
+    __m128i carry = _mm_setzero_si128();
+    mp_size_t i = 0;
+
+    for (; i + 2 <= _an; i += 2) {
+      __m128i a    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_a + i));
+      __m128i even = _mm_clmulepi64_si128(a, b, 0x00);
+      __m128i odd  = _mm_clmulepi64_si128(a, b, 0x01);
+      __m128i * dst = reinterpret_cast<__m128i *>(_dst + i + j);
+
+      _mm_storeu_si128(dst, _mm_xor_si128(_mm_loadu_si128(dst),
+          _mm_xor_si128(_mm_xor_si128(even, _mm_slli_si128(odd, 8)), carry)));
+      carry = _mm_srli_si128(odd, 8);
+    }
+    if ( i < _an ) {
+      carry = _mm_xor_si128(carry,
+          _mm_clmulepi64_si128(_mm_cvtsi64_si128(_a[i]), b, 0x00));
+      _dst[i + j]     ^= _mm_cvtsi128_si64(carry);
+      _dst[i + j + 1] ^= _mm_extract_epi64(carry, 1);
+    } else {
+      _dst[i + j] ^= _mm_cvtsi128_si64(carry);
+    }
+  }
+}
+
+static const ClMulKernels kPclmulClMulKernels = {
+  "pclmul", ClMulPclmul
+};
+
+// Multiplies eight limbs of _a per iteration (four of them per instruction)
+// and the remaining ones using a masked load and store. The products of the
+// odd limbs are moved up by one limb across the lanes. The zero-masked forms
+// of the lane operations avoid an undefined pass-through operand.
+__attribute__((target("avx512f,vpclmulqdq")))
+static void ClMulVpclmul(mp_limb_t * _dst, const mp_limb_t * _a,
+    mp_size_t _an, const mp_limb_t * _b, mp_size_t _bn) {
+  mpn_zero(_dst, _an + _bn);
+  for (mp_size_t j = 0; j < _bn; ++j) {
+    __m512i b = _mm512_set1_epi64(_b[j]);
+    __m512i carry = _mm512_setzero_si512();
+    mp_size_t i = 0;
+
+    for (; i + 8 <= _an; i += 8) {
+      __m512i a    = _mm512_loadu_si512(_a + i);
+      __m512i odd  = _mm512_clmulepi64_epi128(a, b, 0x01);
+      __m512i sum  = _mm512_xor_si512(_mm512_clmulepi64_epi128(a, b, 0x00),
+          _mm512_maskz_alignr_epi64(0xFF, odd, carry, 7));
+
+      _mm512_storeu_si512(_dst + i + j,
+          _mm512_xor_si512(_mm512_loadu_si512(_dst + i + j), sum));
+      carry = odd;
+    }
+    if ( i < _an ) {
+      __mmask8 mask = static_cast<__mmask8>((1u << (_an - i)) - 1);
+      __m512i a   = _mm512_maskz_loadu_epi64(mask, _a + i);
+      __m512i odd = _mm512_clmulepi64_epi128(a, b, 0x01);
+      __m512i sum = _mm512_xor_si512(_mm512_clmulepi64_epi128(a, b, 0x00),
+          _mm512_maskz_alignr_epi64(0xFF, odd, carry, 7));
+
+      // The product reaches one limb beyond the remaining limbs of _a.
+      mask = static_cast<__mmask8>((mask << 1) | 1);
+      _mm512_mask_storeu_epi64(_dst + i + j, mask, _mm512_xor_si512(
+          _mm512_maskz_loadu_epi64(mask, _dst + i + j), sum));
+    } else {
+      _dst[i + j] ^= _mm_extract_epi64(
+          _mm512_maskz_extracti32x4_epi32(0xF, carry, 3), 1);
+    }
+  }
+}
+
+static const ClMulKernels kVpclmulClMulKernels = {
+  "vpclmulqdq", ClMulVpclmul
+};
+#endif /* STDLOGICVECTOR_X86_KERNELS_ */
+
+
+// ****************************************************************************
+// Population count kernels
+// ****************************************************************************
+// Counts the set bits of _a (or of _a ^ _b, if _b is given) one limb at a
+// time. Compiled for the popcnt instruction, __builtin_popcountll() becomes a
+// single instruction instead of a call into libgcc.
+#define POPCOUNT_KERNELS(suffix, attributes)                                   \
+  attributes static mp_bitcnt_t PopCount##suffix(const mp_limb_t * _a,         \
+      const mp_limb_t * _b, mp_size_t _n) {                                    \
+    mp_bitcnt_t count = 0;                                                     \
+    if ( _b == NULL ) {                                                        \
+      for (mp_size_t i = 0; i < _n; ++i) {                                     \
+        count += __builtin_popcountll(_a[i]);                                  \
+      }                                                                        \
+    } else {                                                                   \
+      for (mp_size_t i = 0; i < _n; ++i) {                                     \
+        count += __builtin_popcountll(_a[i] ^ _b[i]);                          \
+      }                                                                        \
+    }                                                                          \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  attributes static void PopCounts##suffix(int * _dst, const mp_limb_t * _a,   \
+      const mp_limb_t * _b, size_t _count, mp_size_t _stride) {                \
+    for (size_t i = 0; i < _count; ++i) {                                      \
+      _dst[i] = static_cast<int>(PopCount##suffix(_a + i * _stride,            \
+          (_b == NULL) ? NULL : _b + i * _stride, _stride));                   \
+    }                                                                          \
+  }
+
+POPCOUNT_KERNELS(Portable, )
+
+static const PopCountKernels kPortablePopCountKernels = {
+  "portable", PopCountPortable, PopCountsPortable
+};
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+POPCOUNT_KERNELS(Popcnt, __attribute__((target("popcnt"))))
+
+static const PopCountKernels kPopcntPopCountKernels = {
+  "popcnt", PopCountPopcnt, PopCountsPopcnt
+};
+
+// Counts the set bits of eight limbs per instruction, and those of the
+// remaining limbs using a masked load.
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static mp_bitcnt_t PopCountAvx512(const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n) {
+  __m512i count = _mm512_setzero_si512();
+  mp_limb_t lanes[8];
+  mp_bitcnt_t total = 0;
+
+  for (mp_size_t i = 0; i < _n; i += 8) {
+    __mmask8 mask = (_n - i >= 8) ? 0xFF :
+        static_cast<__mmask8>((1u << (_n - i)) - 1);
+    __m512i a = _mm512_maskz_loadu_epi64(mask, _a + i);
+
+    if ( _b != NULL ) {
+      a = _mm512_xor_si512(a, _mm512_maskz_loadu_epi64(mask, _b + i));
+    }
+    count = _mm512_add_epi64(count, _mm512_popcnt_epi64(a));
+  }
+  _mm512_storeu_si512(lanes, count);
+  for (int i = 0; i < 8; ++i) {
+    total += lanes[i];
+  }
+  return total;
+}
+
+// Elements of a single limb are counted eight at a time, wider ones one after
+// the other.
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static void PopCountsAvx512(int * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b, size_t _count, mp_size_t _stride) {
+  size_t i = 0;
+
+  if ( _stride == 1 ) {
+    for (; i < _count; i += 8) {
+      __mmask8 mask = (_count - i >= 8) ? 0xFF :
+          static_cast<__mmask8>((1u << (_count - i)) - 1);
+      __m512i a = _mm512_maskz_loadu_epi64(mask, _a + i);
+
+      if ( _b != NULL ) {
+        a = _mm512_xor_si512(a, _mm512_maskz_loadu_epi64(mask, _b + i));
+      }
+      _mm512_mask_cvtepi64_storeu_epi32(_dst + i, mask,
+          _mm512_popcnt_epi64(a));
+    }
+    return;
+  }
+  for (; i < _count; ++i) {
+    _dst[i] = static_cast<int>(PopCountAvx512(_a + i * _stride,
+        (_b == NULL) ? NULL : _b + i * _stride, _stride));
+  }
+}
+
+static const PopCountKernels kAvx512PopCountKernels = {
+  "avx512vpopcntdq", PopCountAvx512, PopCountsAvx512
+};
+#endif /* STDLOGICVECTOR_X86_KERNELS_ */
+#undef POPCOUNT_KERNELS
+
+
+// ****************************************************************************
+// Shuffle kernels
+// ****************************************************************************
+// Lookup table holding the bit-reversed value of each byte.
+#define R2(n) n, n + 2*64, n + 1*64, n + 3*64
+#define R4(n) R2(n), R2(n + 2*16), R2(n + 1*16), R2(n + 3*16)
+#define R6(n) R4(n), R4(n + 2*4 ), R4(n + 1*4 ), R4(n + 3*4 )
+static const unsigned char kReverseByte[256] = {
+  R6(0), R6(2), R6(1), R6(3)
+};
+#undef R6
+#undef R4
+#undef R2
+
+// Reverses the bit order of a single limb using the byte table.
+static inline mp_limb_t ReverseLimb(mp_limb_t _limb) {
+  mp_limb_t result = 0;
+
+  for (unsigned int i = 0; i < sizeof(mp_limb_t); ++i) {
+    result = (result << 8) | kReverseByte[_limb & 0xFF];
+    _limb >>= 8;
+  }
+  return result;
+}
+
+// Swaps the limbs lo and hi - 1 from either end, reversing each, until the
+// two meet.
+static inline void ReverseRange(mp_limb_t * _limbs, mp_size_t _lo,
+    mp_size_t _hi) {
+  while ( _hi - _lo >= 2 ) {
+    mp_limb_t tmp = _limbs[_lo];
+    _limbs[_lo]     = ReverseLimb(_limbs[_hi - 1]);
+    _limbs[_hi - 1] = ReverseLimb(tmp);
+    _lo++;
+    _hi--;
+  }
+  if ( _hi - _lo == 1 ) {
+    _limbs[_lo] = ReverseLimb(_limbs[_lo]);
+  }
+}
+
+static void ReversePortable(mp_limb_t * _limbs, mp_size_t _n) {
+  ReverseRange(_limbs, 0, _n);
+}
+
+static void FormatHexPortable(char * _dst, const mp_limb_t * _limbs,
+    mp_size_t _n, const char * _digits) {
+  char * pos = _dst + _n * (GMP_NUMB_BITS / 4);
+
+  for (mp_size_t i = 0; i < _n; ++i) {
+    mp_limb_t limb = _limbs[i];
+
+    for (unsigned int k = 0; k < GMP_NUMB_BITS / 4; ++k) {
+      *--pos = _digits[limb & 0xF];
+      limb >>= 4;
+    }
+  }
+}
+
+static mp_size_t ParseHexPortable(mp_limb_t * _limbs, const char * _end,
+    mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    const char * src = _end - (i + 1) * (GMP_NUMB_BITS / 4);
+    mp_limb_t limb = 0;
+
+    for (unsigned int k = 0; k < GMP_NUMB_BITS / 4; ++k) {
+      unsigned int digit = static_cast<unsigned char>(src[k]) - '0';
+      unsigned int alpha = (static_cast<unsigned char>(src[k]) | 0x20) - 'a';
+
+      if ( digit < 10 ) {
+        limb = (limb << 4) | digit;
+      } else if ( alpha < 6 ) {
+        limb = (limb << 4) | (alpha + 10);
+      } else {
+        return i;
+      }
+    }
+    _limbs[i] = limb;
+  }
+  return _n;
+}
+
+static mp_size_t ParseBinaryPortable(mp_limb_t * _limbs, const char * _end,
+    mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    const char * src = _end - (i + 1) * GMP_NUMB_BITS;
+    mp_limb_t limb = 0;
+
+    for (unsigned int k = 0; k < GMP_NUMB_BITS; ++k) {
+      unsigned int digit = static_cast<unsigned char>(src[k]) - '0';
+
+      if ( digit > 1 ) {
+        return i;
+      }
+      limb = (limb << 1) | digit;
+    }
+    _limbs[i] = limb;
+  }
+  return _n;
+}
+
+static const ShuffleKernels kPortableShuffleKernels = {
+  "portable", ReversePortable, FormatHexPortable, ParseHexPortable,
+  ParseBinaryPortable
+};
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+// Reverses the bit order of a 128-bit block (i.e., two limbs) by reversing the
+// nibbles of each byte with pshufb and then reversing the order of the bytes.
+__attribute__((target("ssse3")))
+static inline __m128i ReverseBlock(__m128i _block) {
+  const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+  const __m128i reverseLo  = _mm_setr_epi8(
+      0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0,
+      0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0);
+  const __m128i reverseHi  = _mm_setr_epi8(
+      0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E,
+      0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+  const __m128i byteOrder  = _mm_setr_epi8(
+      15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m128i lo = _mm_shuffle_epi8(reverseLo, _mm_and_si128(_block, nibbleMask));
+  __m128i hi = _mm_shuffle_epi8(reverseHi,
+      _mm_and_si128(_mm_srli_epi16(_block, 4), nibbleMask));
+
+  return _mm_shuffle_epi8(_mm_or_si128(lo, hi), byteOrder);
+}
+
+// Swaps two limbs from either end at once, and the remaining ones using the
+// byte table.
+__attribute__((target("ssse3")))
+static void ReverseSsse3(mp_limb_t * _limbs, mp_size_t _n) {
+  mp_size_t lo = 0;
+  mp_size_t hi = _n;
+
+  while ( hi - lo >= 4 ) {
+    __m128i front = _mm_loadu_si128(reinterpret_cast<__m128i *>(_limbs + lo));
+    __m128i back  = _mm_loadu_si128(
+        reinterpret_cast<__m128i *>(_limbs + hi - 2));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_limbs + lo),
+        ReverseBlock(back));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_limbs + hi - 2),
+        ReverseBlock(front));
+    lo += 2;
+    hi -= 2;
+  }
+  ReverseRange(_limbs, lo, hi);
+}
+
+// Splits the bytes of each limb into nibbles and looks up the digits of all
+// nibbles with a single pshufb.
+__attribute__((target("ssse3")))
+static void FormatHexSsse3(char * _dst, const mp_limb_t * _limbs,
+    mp_size_t _n, const char * _digits) {
+  const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+  const __m128i digitOrder = _mm_setr_epi8(
+      14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_digits));
+
+  for (mp_size_t i = 0; i < _n; ++i) {
+    __m128i bytes = _mm_cvtsi64_si128(_limbs[i]);
+    __m128i lo    = _mm_and_si128(bytes, nibbleMask);
+    __m128i hi    = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+    __m128i nibbles = _mm_shuffle_epi8(_mm_unpacklo_epi8(hi, lo), digitOrder);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + (_n - 1 - i) * 16),
+        _mm_shuffle_epi8(lut, nibbles));
+  }
+}
+
+// Classifies and converts the 16 digits of each limb at once.
+__attribute__((target("ssse3")))
+static mp_size_t ParseHexSsse3(mp_limb_t * _limbs, const char * _end,
+    mp_size_t _n) {
+  for (mp_size_t i = 0; i < _n; ++i) {
+    __m128i chars = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(_end - (i + 1) * 16));
+    __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+        _mm_set1_epi8('a'));
+    __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)),
+        digit);
+    __m128i isAlpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)),
+        alpha);
+    __m128i nibbles, bytes;
+
+    if ( _mm_movemask_epi8(_mm_or_si128(isDigit, isAlpha)) != 0xFFFF ) {
+      return i;
+    }
+    nibbles = _mm_or_si128(_mm_and_si128(isDigit, digit),
+        _mm_and_si128(isAlpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+    // Combine pairs of nibbles into bytes, the first character being the most
+    // significant one.
+    bytes = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+    bytes = _mm_packus_epi16(bytes, bytes);
+    _limbs[i] = __builtin_bswap64(_mm_cvtsi128_si64(bytes));
+  }
+  return _n;
+}
+
+// Compares 16 characters of each limb at once and gathers the bits with
+// movemask.
+__attribute__((target("ssse3")))
+static mp_size_t ParseBinarySsse3(mp_limb_t * _limbs, const char * _end,
+    mp_size_t _n) {
+  const __m128i charOrder = _mm_setr_epi8(
+      15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+  for (mp_size_t i = 0; i < _n; ++i) {
+    const char * src = _end - (i + 1) * 64;
+    mp_limb_t limb = 0;
+
+    for (int k = 0; k < 64; k += 16) {
+      __m128i chars = _mm_shuffle_epi8(_mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(src + k)), charOrder);
+      __m128i ones  = _mm_cmpeq_epi8(chars, _mm_set1_epi8('1'));
+      __m128i zeros = _mm_cmpeq_epi8(chars, _mm_set1_epi8('0'));
+
+      if ( _mm_movemask_epi8(_mm_or_si128(ones, zeros)) != 0xFFFF ) {
+        return i;
+      }
+      limb = (limb << 16) | _mm_movemask_epi8(ones);
+    }
+    _limbs[i] = limb;
+  }
+  return _n;
+}
+
+static const ShuffleKernels kSsse3ShuffleKernels = {
+  "ssse3", ReverseSsse3, FormatHexSsse3, ParseHexSsse3, ParseBinarySsse3
+};
+#endif /* STDLOGICVECTOR_X86_KERNELS_ */
+
+
+// ****************************************************************************
+// Kernel selection
+// ****************************************************************************
+/**
+ * @brief Returns all kernel sets supported by the host CPU, starting with the
+ *   fastest one.
+ * @param _kernels The array to be filled.
+ * @param _max The size of @p _kernels.
+ * @return The number of kernel sets written to @p _kernels.
+ */
+int AvailableBitwiseKernels(const BitwiseKernels * _kernels[], int _max) {
+  const BitwiseKernels * available[3];
+  int count = 0;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx512f") ) {
+    available[count++] = &kAvx512Kernels;
+  }
+  if ( __builtin_cpu_supports("avx2") ) {
+    available[count++] = &kAvx2Kernels;
+  }
+#endif
+  available[count++] = &kPortableKernels;
+
+  for (int i = 0; i < count && i < _max; ++i) {
+    _kernels[i] = available[i];
+  }
+  return min(count, _max);
+}
+
+/**
+ * @brief Returns the fastest kernel set supported by the host CPU. The CPU is
+ *   only checked on the first call.
+ */
+const BitwiseKernels & ActiveBitwiseKernels() {
+  static const BitwiseKernels & active = *[]() {
+    const BitwiseKernels * fastest;
+    AvailableBitwiseKernels(&fastest, 1);
+    return fastest;
+  }();
+
+  return active;
+}
+
+/**
+ * @brief Returns all nine-valued logic kernel sets supported by the host CPU,
+ *   starting with the fastest one.
+ * @param _kernels The array to be filled.
+ * @param _max The size of @p _kernels.
+ * @return The number of kernel sets written to @p _kernels.
+ */
+int AvailableULogicKernels(const ULogicKernels * _kernels[], int _max) {
+  const ULogicKernels * available[3];
+  int count = 0;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx512f") ) {
+    available[count++] = &kAvx512ULogicKernels;
+  }
+  if ( __builtin_cpu_supports("avx2") ) {
+    available[count++] = &kAvx2ULogicKernels;
+  }
+#endif
+  available[count++] = &kPortableULogicKernels;
+
+  for (int i = 0; i < count && i < _max; ++i) {
+    _kernels[i] = available[i];
+  }
+  return min(count, _max);
+}
+
+/**
+ * @brief Returns the fastest nine-valued logic kernel set supported by the
+ *   host CPU. The CPU is only checked on the first call.
+ */
+const ULogicKernels & ActiveULogicKernels() {
+  static const ULogicKernels & active = *[]() {
+    const ULogicKernels * fastest;
+    AvailableULogicKernels(&fastest, 1);
+    return fastest;
+  }();
+
+  return active;
+}
+
+/**
+ * @brief Returns all carry-less multiplication kernel sets supported by the
+ *   host CPU, starting with the fastest one.
+ * @param _kernels The array to be filled.
+ * @param _max The size of @p _kernels.
+ * @return The number of kernel sets written to @p _kernels.
+ */
+int AvailableClMulKernels(const ClMulKernels * _kernels[], int _max) {
+  const ClMulKernels * available[3];
+  int count = 0;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx512f") &&
+       __builtin_cpu_supports("vpclmulqdq") ) {
+    available[count++] = &kVpclmulClMulKernels;
+  }
+  if ( __builtin_cpu_supports("pclmul") ) {
+    available[count++] = &kPclmulClMulKernels;
+  }
+#endif
+  available[count++] = &kPortableClMulKernels;
+
+  for (int i = 0; i < count && i < _max; ++i) {
+    _kernels[i] = available[i];
+  }
+  return min(count, _max);
+}
+
+/**
+ * @brief Returns the fastest carry-less multiplication kernel set supported by
+ *   the host CPU. The CPU is only checked on the first call.
+ */
+const ClMulKernels & ActiveClMulKernels() {
+  static const ClMulKernels & active = *[]() {
+    const ClMulKernels * fastest;
+    AvailableClMulKernels(&fastest, 1);
+    return fastest;
+  }();
+
+  return active;
+}
+
+/**
+ * @brief Returns all population count kernel sets supported by the host CPU,
+ *   starting with the fastest one.
+ * @param _kernels The array to be filled.
+ * @param _max The size of @p _kernels.
+ * @return The number of kernel sets written to @p _kernels.
+ */
+int AvailablePopCountKernels(const PopCountKernels * _kernels[], int _max) {
+  const PopCountKernels * available[3];
+  int count = 0;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx512f") &&
+       __builtin_cpu_supports("avx512vpopcntdq") ) {
+    available[count++] = &kAvx512PopCountKernels;
+  }
+  if ( __builtin_cpu_supports("popcnt") ) {
+    available[count++] = &kPopcntPopCountKernels;
+  }
+#endif
+  available[count++] = &kPortablePopCountKernels;
+
+  for (int i = 0; i < count && i < _max; ++i) {
+    _kernels[i] = available[i];
+  }
+  return min(count, _max);
+}
+
+/**
+ * @brief Returns the fastest population count kernel set supported by the
+ *   host CPU. The CPU is only checked on the first call.
+ */
+const PopCountKernels & ActivePopCountKernels() {
+  static const PopCountKernels & active = *[]() {
+    const PopCountKernels * fastest;
+    AvailablePopCountKernels(&fastest, 1);
+    return fastest;
+  }();
+
+  return active;
+}
+
+/**
+ * @brief Returns all shuffle kernel sets supported by the host CPU, starting
+ *   with the fastest one.
+ * @param _kernels The array to be filled.
+ * @param _max The size of @p _kernels.
+ * @return The number of kernel sets written to @p _kernels.
+ */
+int AvailableShuffleKernels(const ShuffleKernels * _kernels[], int _max) {
+  const ShuffleKernels * available[2];
+  int count = 0;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("ssse3") ) {
+    available[count++] = &kSsse3ShuffleKernels;
+  }
+#endif
+  available[count++] = &kPortableShuffleKernels;
+
+  for (int i = 0; i < count && i < _max; ++i) {
+    _kernels[i] = available[i];
+  }
+  return min(count, _max);
+}
+
+/**
+ * @brief Returns the fastest shuffle kernel set supported by the host CPU.
+ *   The CPU is only checked on the first call.
+ */
+const ShuffleKernels & ActiveShuffleKernels() {
+  static const ShuffleKernels & active = *[]() {
+    const ShuffleKernels * fastest;
+    AvailableShuffleKernels(&fastest, 1);
+    return fastest;
+  }();
+
+  return active;
+}
+
+// ****************************************************************************
+// Arithmetic kernels
+// ****************************************************************************
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+/**
+ * @brief Adds two numbers of @p N limbs using a fully unrolled carry chain.
+ * @return The carry out of the most significant limb.
+ */
+template <int N>
+static mp_limb_t AddFixed(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b) {
+  unsigned char carry = 0;
+
+#pragma GCC unroll 8
+  for (int i = 0; i < N; ++i) {
+    unsigned long long sum;
+    carry   = _addcarry_u64(carry, _a[i], _b[i], &sum);
+    _dst[i] = sum;
+  }
+  return carry;
+}
+
+/**
+ * @brief Subtracts two numbers of @p N limbs using a fully unrolled borrow
+ *   chain.
+ * @return The borrow out of the most significant limb.
+ */
+template <int N>
+static mp_limb_t SubFixed(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b) {
+  unsigned char borrow = 0;
+
+#pragma GCC unroll 8
+  for (int i = 0; i < N; ++i) {
+    unsigned long long diff;
+    borrow  = _subborrow_u64(borrow, _a[i], _b[i], &diff);
+    _dst[i] = diff;
+  }
+  return borrow;
+}
+
+/**
+ * @brief Computes the @p N least significant limbs of the product of two
+ *   numbers of @p N limbs (i.e., only the lower triangle of the schoolbook
+ *   multiplication).
+ */
+template <int N>
+static void MulLowFixed(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b) {
+  mp_limb_t result[N] = {};
+
+#pragma GCC unroll 8
+  for (int i = 0; i < N; ++i) {
+    mp_limb_t carry = 0;
+#pragma GCC unroll 8
+    for (int j = 0; j < N - i; ++j) {
+      unsigned __int128 t = static_cast<unsigned __int128>(_a[i]) * _b[j] +
+          result[i + j] + carry;
+      result[i + j] = static_cast<mp_limb_t>(t);
+      carry         = static_cast<mp_limb_t>(t >> 64);
+    }
+  }
+  copy(result, result + N, _dst);
+}
+
+/**
+ * @brief Computes the full product of two numbers of @p N limbs.
+ */
+template <int N>
+static void MulFixed(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b) {
+  mp_limb_t result[2 * N] = {};
+
+#pragma GCC unroll 8
+  for (int i = 0; i < N; ++i) {
+    mp_limb_t carry = 0;
+#pragma GCC unroll 8
+    for (int j = 0; j < N; ++j) {
+      unsigned __int128 t = static_cast<unsigned __int128>(_a[i]) * _b[j] +
+          result[i + j] + carry;
+      result[i + j] = static_cast<mp_limb_t>(t);
+      carry         = static_cast<mp_limb_t>(t >> 64);
+    }
+    result[i + N] = carry;
+  }
+  copy(result, result + 2 * N, _dst);
+}
+
+/**
+ * @brief Computes the upper @p N limbs of the product of two numbers of @p N
+ *   limbs, omitting the partial products below limb @p N - 2. The result is
+ *   at most one below the exact upper half.
+ */
+template <int N>
+static void MulHighFixed(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b) {
+  mp_limb_t result[2 * N] = {};
+
+#pragma GCC unroll 8
+  for (int i = 0; i < N; ++i) {
+    mp_limb_t carry = 0;
+#pragma GCC unroll 8
+    for (int j = (i < N - 2) ? N - 2 - i : 0; j < N; ++j) {
+      unsigned __int128 t = static_cast<unsigned __int128>(_a[i]) * _b[j] +
+          result[i + j] + carry;
+      result[i + j] = static_cast<mp_limb_t>(t);
+      carry         = static_cast<mp_limb_t>(t >> 64);
+    }
+    result[i + N] = carry;
+  }
+  copy(result + N, result + 2 * N, _dst);
+}
+
+/**
+ * @brief Montgomery multiplication of two numbers of @p N limbs, interleaving
+ *   the multiplication and the reduction a limb at a time (CIOS).
+ */
+template <int N>
+static void MontMulFixed(mp_limb_t * _dst, const mp_limb_t * _a,
+    const mp_limb_t * _b, const mp_limb_t * _m, mp_limb_t _mPrime) {
+  mp_limb_t t[N + 2] = {};
+
+#pragma GCC unroll 8
+  for (int i = 0; i < N; ++i) {
+    mp_limb_t carry = 0;
+    mp_limb_t q;
+    unsigned __int128 uv;
+
+#pragma GCC unroll 8
+    for (int j = 0; j < N; ++j) {
+      uv    = static_cast<unsigned __int128>(_a[i]) * _b[j] + t[j] + carry;
+      t[j]  = static_cast<mp_limb_t>(uv);
+      carry = static_cast<mp_limb_t>(uv >> 64);
+    }
+    uv       = static_cast<unsigned __int128>(t[N]) + carry;
+    t[N]     = static_cast<mp_limb_t>(uv);
+    t[N + 1] = static_cast<mp_limb_t>(uv >> 64);
+
+    // Add q * m, such that the least significant limb becomes zero, and drop
+    // that limb.
+    q     = t[0] * _mPrime;
+    uv    = static_cast<unsigned __int128>(q) * _m[0] + t[0];
+    carry = static_cast<mp_limb_t>(uv >> 64);
+#pragma GCC unroll 8
+    for (int j = 1; j < N; ++j) {
+      uv       = static_cast<unsigned __int128>(q) * _m[j] + t[j] + carry;
+      t[j - 1] = static_cast<mp_limb_t>(uv);
+      carry    = static_cast<mp_limb_t>(uv >> 64);
+    }
+    uv       = static_cast<unsigned __int128>(t[N]) + carry;
+    t[N - 1] = static_cast<mp_limb_t>(uv);
+    t[N]     = t[N + 1] + static_cast<mp_limb_t>(uv >> 64);
+  }
+
+  // The result is below 2m.
+  if ( t[N] != 0 || mpn_cmp(t, _m, N) >= 0 ) {
+    SubFixed<N>(t, t, _m);
+  }
+  copy(t, t + N, _dst);
+}
+
+typedef void (*MontgomeryFixed)(mp_limb_t *, const mp_limb_t *,
+    const mp_limb_t *, const mp_limb_t *, mp_limb_t);
+
+static const MontgomeryFixed kMontMulFixed[] = { NULL, MontMulFixed<1>,
+    MontMulFixed<2>, MontMulFixed<3>, MontMulFixed<4>, MontMulFixed<5>,
+    MontMulFixed<6>, MontMulFixed<7>, MontMulFixed<8> };
+
+typedef mp_limb_t (*CarryFixed)(mp_limb_t *, const mp_limb_t *,
+    const mp_limb_t *);
+typedef void (*ProductFixed)(mp_limb_t *, const mp_limb_t *,
+    const mp_limb_t *);
+
+// The unrolled kernels, indexed by their number of limbs.
+static const CarryFixed kAddFixed[] = { NULL, AddFixed<1>, AddFixed<2>,
+    AddFixed<3>, AddFixed<4>, AddFixed<5>, AddFixed<6>, AddFixed<7>,
+    AddFixed<8> };
+static const CarryFixed kSubFixed[] = { NULL, SubFixed<1>, SubFixed<2>,
+    SubFixed<3>, SubFixed<4>, SubFixed<5>, SubFixed<6>, SubFixed<7>,
+    SubFixed<8> };
+static const ProductFixed kMulLowFixed[] = { NULL, MulLowFixed<1>,
+    MulLowFixed<2>, MulLowFixed<3>, MulLowFixed<4>, MulLowFixed<5>,
+    MulLowFixed<6>, MulLowFixed<7>, MulLowFixed<8> };
+static const ProductFixed kMulFixed[] = { NULL, MulFixed<1>, MulFixed<2>,
+    MulFixed<3>, MulFixed<4>, MulFixed<5>, MulFixed<6>, MulFixed<7>,
+    MulFixed<8> };
+static const ProductFixed kMulHighFixed[] = { NULL, MulHighFixed<1>,
+    MulHighFixed<2>, MulHighFixed<3>, MulHighFixed<4>, MulHighFixed<5>,
+    MulHighFixed<6>, MulHighFixed<7>, MulHighFixed<8> };
+
+static_assert(sizeof(kAddFixed) / sizeof(kAddFixed[0]) == kUnrolledLimbs + 1,
+    "One unrolled kernel is required per number of limbs.");
+#endif /* STDLOGICVECTOR_X86_KERNELS_ */
+
+// Above this number of limbs, the truncated product is computed as a full
+// product, which lets GMP use its sub-quadratic algorithms.
+static const mp_size_t kMulLowFullThreshold = 32;
+
+/**
+ * @brief Adds two numbers of @p _n limbs.
+ * @return The carry out of the most significant limb.
+ */
+mp_limb_t AddLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n) {
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  if ( _n <= kUnrolledLimbs ) {
+    return kAddFixed[_n](_dst, _a, _b);
+  }
+#endif
+  return mpn_add_n(_dst, _a, _b, _n);
+}
+
+/**
+ * @brief Subtracts two numbers of @p _n limbs.
+ * @return The borrow out of the most significant limb.
+ */
+mp_limb_t SubLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n) {
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  if ( _n <= kUnrolledLimbs ) {
+    return kSubFixed[_n](_dst, _a, _b);
+  }
+#endif
+  return mpn_sub_n(_dst, _a, _b, _n);
+}
+
+/**
+ * @brief Computes the @p _n least significant limbs of the product of two
+ *   numbers of @p _n limbs (i.e., the product modulo 2^(@p _n * limb bits)).
+ *   Wide products are computed in full within the scratch limbs.
+ */
+void MulLowLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n, mp_limb_t * _scratch) {
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  if ( _n <= kUnrolledLimbs ) {
+    kMulLowFixed[_n](_dst, _a, _b);
+    return;
+  }
+#endif
+  if ( _n > kMulLowFullThreshold ) {
+    MulLimbs(_scratch, _a, _n, _b, _n);
+    mpn_copyi(_dst, _scratch, _n);
+    return;
+  }
+  // Only the lower triangle of the schoolbook multiplication is computed.
+  mpn_mul_1(_dst, _a, _n, _b[0]);
+  for (mp_size_t i = 1; i < _n; ++i) {
+    mpn_addmul_1(_dst + i, _a, _n - i, _b[i]);
+  }
+}
+
+/**
+ * @brief Computes the full product of two numbers of @p _an and @p _bn limbs.
+ */
+void MulLimbs(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _an,
+    const mp_limb_t * _b, mp_size_t _bn) {
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  if ( _an == _bn && _an <= kUnrolledLimbs ) {
+    kMulFixed[_an](_dst, _a, _b);
+    return;
+  }
+#endif
+  if ( _a == _b && _an == _bn ) {
+    mpn_sqr(_dst, _a, _an);
+  } else if ( _an >= _bn ) {
+    mpn_mul(_dst, _a, _an, _b, _bn);
+  } else {
+    mpn_mul(_dst, _b, _bn, _a, _an);
+  }
+}
+
+/**
+ * @brief Computes the upper @p _n limbs of the product of two numbers of
+ *   @p _n limbs, omitting the partial products below limb @p _n - 2 (i.e.,
+ *   about half of them). The omitted ones sum up to less than 2^(64 * _n),
+ *   such that the result is at most one below the exact upper half.
+ */
+void MulHighLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    mp_size_t _n, mp_limb_t * _scratch) {
+  mp_size_t low = (_n > 2) ? _n - 2 : 0;
+  mp_limb_t * t = _scratch;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  if ( _n <= kUnrolledLimbs ) {
+    kMulHighFixed[_n](_dst, _a, _b);
+    return;
+  }
+#endif
+  // Row i adds the partial products from limb max(i, _n - 2) on, such that
+  // the limbs below _n - 2 are never touched.
+  mpn_zero(t + low, _n - low);
+  for (mp_size_t i = 0; i < _n; ++i) {
+    mp_size_t j = (i < low) ? low - i : 0;
+
+    t[i + _n] = mpn_addmul_1(t + i + j, _b + j, _n - j, _a[i]);
+  }
+  mpn_copyi(_dst, t + _n, _n);
+}
+
+/**
+ * @brief Montgomery multiplication. Larger operands are multiplied (or
+ *   squared) first and then reduced a limb at a time (REDC).
+ */
+void MontMulLimbs(mp_limb_t * _dst, const mp_limb_t * _a, const mp_limb_t * _b,
+    const mp_limb_t * _m, mp_limb_t _mPrime, mp_size_t _n,
+    mp_limb_t * _scratch) {
+  mp_limb_t * t = _scratch;
+
+#ifdef STDLOGICVECTOR_X86_KERNELS_
+  if ( _n <= kUnrolledLimbs ) {
+    kMontMulFixed[_n](_dst, _a, _b, _m, _mPrime);
+    return;
+  }
+#endif
+  MulLimbs(t, _a, _n, _b, _n);
+  // Each step clears the least significant limb. Since it becomes zero, the
+  // carry out of the step is kept in its place and added at the end.
+  for (mp_size_t i = 0; i < _n; ++i) {
+    t[i] = mpn_addmul_1(t + i, _m, _n, t[i] * _mPrime);
+  }
+  if ( mpn_add_n(_dst, t + _n, t, _n) != 0 || mpn_cmp(_dst, _m, _n) >= 0 ) {
+    mpn_sub_n(_dst, _dst, _m, _n);
+  }
+}
+
+
+// ****************************************************************************
+// Carry-less arithmetic
+// ****************************************************************************
+// From this number of limbs on, carry-less products are split into halves
+// (Karatsuba).
+static const mp_size_t kClMulKaratsubaLimbs = 16;
+
+/**
+ * @brief Karatsuba multiplication of two polynomials of @p _n limbs each. The
+ *   scratch must hold 4 * @p _n limbs plus four limbs per level of
+ *   recursion.
+ */
+static void ClMulKaratsuba(const ClMulKernels & _kernels, mp_limb_t * _dst,
+    const mp_limb_t * _a, const mp_limb_t * _b, mp_size_t _n,
+    mp_limb_t * _scratch) {
+  const BitwiseKernels & bitwise = ActiveBitwiseKernels();
+  mp_size_t lo = _n / 2;
+  mp_size_t hi = _n - lo;
+  mp_limb_t * a   = _scratch;
+  mp_limb_t * b   = a + hi;
+  mp_limb_t * mid = b + hi;
+
+  if ( _n < kClMulKaratsubaLimbs ) {
+    _kernels.Mul(_dst, _a, _n, _b, _n);
+    return;
+  }
+
+  // (a1 x + a0)(b1 x + b0) = a1 b1 x^2 + ((a0 + a1)(b0 + b1) + a0 b0 + a1 b1) x
+  // + a0 b0, where additions and subtractions are both a XOR.
+  ClMulKaratsuba(_kernels, _dst, _a, _b, lo, _scratch);
+  ClMulKaratsuba(_kernels, _dst + 2 * lo, _a + lo, _b + lo, hi, _scratch);
+  bitwise.Xor(a, _a, _a + lo, lo);
+  bitwise.Xor(b, _b, _b + lo, lo);
+  if ( hi > lo ) {
+    a[lo] = _a[_n - 1];
+    b[lo] = _b[_n - 1];
+  }
+  ClMulKaratsuba(_kernels, mid, a, b, hi, mid + 2 * hi);
+  bitwise.Xor(mid, mid, _dst, 2 * lo);
+  bitwise.Xor(mid, mid, _dst + 2 * lo, 2 * hi);
+  bitwise.Xor(_dst + lo, _dst + lo, mid, 2 * hi);
+}
+
+/**
+ * @brief Computes the full carry-less product of two polynomials of @p _an
+ *   and @p _bn limbs. Unbalanced operands are multiplied in chunks of the
+ *   length of the shorter one.
+ */
+void ClMulLimbs(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _an,
+    const mp_limb_t * _b, mp_size_t _bn) {
+  const ClMulKernels & kernels = ActiveClMulKernels();
+  vector<mp_limb_t> scratch;
+  mp_limb_t * chunk;
+  mp_limb_t * product;
+
+  if ( _an < _bn ) {
+    swap(_a, _b);
+    swap(_an, _bn);
+  }
+  if ( _bn < kClMulKaratsubaLimbs ) {
+    kernels.Mul(_dst, _a, _an, _b, _bn);
+    return;
+  }
+  if ( _an == _bn ) {
+    scratch.resize(4 * _bn + 2 * GMP_NUMB_BITS);
+    ClMulKaratsuba(kernels, _dst, _a, _b, _bn, scratch.data());
+    return;
+  }
+
+  scratch.resize(7 * _bn + 2 * GMP_NUMB_BITS);
+  chunk   = scratch.data();
+  product = chunk + _bn;
+  mpn_zero(_dst, _an + _bn);
+  for (mp_size_t i = 0; i < _an; i += _bn) {
+    mp_size_t n = min(_bn, _an - i);
+
+    mpn_copyi(chunk, _a + i, n);
+    mpn_zero(chunk + n, _bn - n);
+    ClMulKaratsuba(kernels, product, chunk, _b, _bn, product + 2 * _bn);
+    ActiveBitwiseKernels().Xor(_dst + i, _dst + i, product, n + _bn);
+  }
+}
+
+/**
+ * @brief Computes the carry-less square of a polynomial of @p _n limbs. Since
+ *   squaring over GF(2) is linear, it merely interleaves the bits of the
+ *   operand with zeros.
+ */
+void ClSquareLimbs(mp_limb_t * _dst, const mp_limb_t * _a, mp_size_t _n) {
+#if GMP_NUMB_BITS == 64
+  static const mp_limb_t kMasks[] = { 0x0000FFFF0000FFFFULL,
+      0x00FF00FF00FF00FFULL, 0x0F0F0F0F0F0F0F0FULL, 0x3333333333333333ULL,
+      0x5555555555555555ULL };
+
+  // Iterating downwards allows the destination to be the operand.
+  for (mp_size_t i = _n - 1; i >= 0; --i) {
+    mp_limb_t lo = _a[i] & 0xFFFFFFFFULL;
+    mp_limb_t hi = _a[i] >> 32;
+
+    for (int k = 0, shift = 16; k < 5; ++k, shift /= 2) {
+      lo = (lo | (lo << shift)) & kMasks[k];
+      hi = (hi | (hi << shift)) & kMasks[k];
+    }
+    _dst[2 * i]     = lo;
+    _dst[2 * i + 1] = hi;
+  }
+#else
+  ClMulLimbs(_dst, _a, _n, _a, _n);
+#endif
+}
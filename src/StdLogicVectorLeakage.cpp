@@ -0,0 +1,447 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorLeakage.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Simulated power traces of StdLogicVector models
+ * @version 0.1
+ *
+ * The values of all probes are kept in flat limb buffers (like the elements
+ * of a StdLogicVectorArray), such that the Hamming weights and distances are
+ * computed by a single call of the population count kernels of
+ * StdLogicVectorKernels. The noise is drawn from a xoshiro256+
+ * generator seeded per trace, such that the generated traces do not depend
+ * on the number of threads.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "StdLogicVectorLeakage.h"
+#include "StdLogicVectorKernels.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+/**
+ * @brief Advances a splitmix64 state and returns its next output (used to
+ *   expand a seed into the state of the xoshiro256+ generator).
+ */
+static uint64_t SplitMix64(uint64_t & _state) {
+	uint64_t z = (_state += 0x9E3779B97F4A7C15ULL);
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/**
+ * @brief Returns the next output of a xoshiro256+ generator.
+ */
+static uint64_t Xoshiro256Plus(uint64_t _state[4]) {
+	uint64_t result = _state[0] + _state[3];
+	uint64_t t = _state[1] << 17;
+
+	_state[2] ^= _state[0];
+	_state[3] ^= _state[1];
+	_state[1] ^= _state[2];
+	_state[0] ^= _state[3];
+	_state[2] ^= t;
+	_state[3] = (_state[3] << 45) | (_state[3] >> 19);
+	return result;
+}
+
+/**
+ * @brief Converts the samples of a trace into the sample format of a trace
+ *   file.
+ * @param _dst The destination (of @p _count samples of the given format).
+ * @param _samples The samples of the trace.
+ * @param _count The number of samples.
+ * @param _format The sample format.
+ * @param _scale The factor all samples are multiplied with. Scaled int16
+ *   samples are rounded to the nearest integer and saturated.
+ */
+static void EncodeSamples(char * _dst, const float * _samples, size_t _count,
+		StdLogicVectorLeakage::SampleFormat _format, float _scale) {
+	if ( _format == StdLogicVectorLeakage::kFloat32 ) {
+		float * dst = reinterpret_cast<float *>(_dst);
+
+		for (size_t i = 0; i < _count; ++i) {
+			dst[i] = _samples[i] * _scale;
+		}
+	} else {
+		int16_t * dst = reinterpret_cast<int16_t *>(_dst);
+
+		for (size_t i = 0; i < _count; ++i) {
+			float sample = nearbyintf(_samples[i] * _scale);
+
+			sample = min(max(sample, -32768.0f), 32767.0f);
+			dst[i] = static_cast<int16_t>(sample);
+		}
+	}
+}
+
+
+// ****************************************************************************
+// Constructors
+// ****************************************************************************
+/**
+ * @brief Creates a StdLogicVectorLeakage without any probes.
+ * @param _model The power model of the probes.
+ * @param _samples The number of samples (i.e., cycles) per trace.
+ * @param _noise The standard deviation of the Gaussian noise added to each
+ *   sample (0 for noise-free traces).
+ */
+StdLogicVectorLeakage::StdLogicVectorLeakage(Model _model, int _samples,
+		double _noise) : model_(_model), noise_(max(_noise, 0.0)),
+		samples_(max(_samples, 0)), cycle_(0), leakage_(0), spare_(0.0),
+		hasSpare_(false)
+{
+	Reset(0);
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the power model of the probes.
+ */
+StdLogicVectorLeakage::Model StdLogicVectorLeakage::getModel() const {
+	return model_;
+}
+
+/**
+ * @brief Returns the number of samples per trace.
+ */
+int StdLogicVectorLeakage::getSampleCount() const {
+	return static_cast<int>(samples_.size());
+}
+
+/**
+ * @brief Returns the standard deviation of the noise added to each sample.
+ */
+double StdLogicVectorLeakage::getNoise() const {
+	return noise_;
+}
+
+/**
+ * @brief Returns the number of cycles completed since the last Reset().
+ */
+int StdLogicVectorLeakage::getCycle() const {
+	return cycle_;
+}
+
+/**
+ * @brief Returns the samples of the current trace. Samples of cycles not
+ *   completed yet are 0.
+ */
+const float * StdLogicVectorLeakage::getSamples() const {
+	return samples_.data();
+}
+
+
+// ****************************************************************************
+// Recording
+// ****************************************************************************
+/**
+ * @brief Adds a probe, i.e., a leaking register of the model.
+ * @param _initial The value of the register at the start of each trace (its
+ *   reset value), from which the first Hamming distance is computed.
+ * @return The index of the probe to be passed to Leak().
+ */
+int StdLogicVectorLeakage::AddProbe(const StdLogicVector & _initial) {
+	Probe probe;
+
+	probe.offset = initial_.size();
+	probe.length = _initial.getLength();
+	probe.size   = (probe.length + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+	probes_.push_back(probe);
+
+	initial_.resize(probe.offset + probe.size, 0);
+	previous_.resize(initial_.size(), 0);
+	current_.resize(max<size_t>(current_.size(), probe.size), 0);
+	Load(&initial_[probe.offset], probe, _initial);
+	mpn_copyi(&previous_[probe.offset], &initial_[probe.offset], probe.size);
+	return static_cast<int>(probes_.size()) - 1;
+}
+
+/**
+ * @brief Starts a new trace. All samples are cleared and all probes are set
+ *   back to their initial values.
+ * @param _seed The seed of the noise of the trace.
+ */
+void StdLogicVectorLeakage::Reset(uint64_t _seed) {
+	fill(samples_.begin(), samples_.end(), 0.0f);
+	cycle_   = 0;
+	leakage_ = 0;
+	copy(initial_.begin(), initial_.end(), previous_.begin());
+	for (int i = 0; i < 4; ++i) {
+		random_[i] = SplitMix64(_seed);
+	}
+	hasSpare_ = false;
+}
+
+/**
+ * @brief Reports the value of a probe within the current cycle.
+ *
+ * Under the Hamming-weight model, the number of ones of @p _value is added to
+ * the sample of the cycle. Under the Hamming-distance model, the number of
+ * bits differing from the previous value of the probe is added instead. Bits
+ * of @p _value beyond the length of the probe are ignored.
+ *
+ * @param _probe The index of the probe (as returned by AddProbe()).
+ * @param _value The value of the probe.
+ */
+void StdLogicVectorLeakage::Leak(int _probe, const StdLogicVector & _value) {
+	if ( static_cast<unsigned int>(_probe) >= probes_.size() ) {
+		return;
+	}
+
+	const PopCountKernels & kernels = ActivePopCountKernels();
+	const Probe & probe = probes_[_probe];
+	mp_limb_t * previous = &previous_[probe.offset];
+	const mp_limb_t * value = mpz_limbs_read(_value.getValue());
+	mp_size_t size = mpz_size(_value.getValue());
+	unsigned int rem = probe.length % GMP_NUMB_BITS;
+
+	// Values filling exactly the limbs of the probe are read in place.
+	if ( size != probe.size || (rem != 0 && (value[size - 1] >> rem) != 0) ) {
+		Load(current_.data(), probe, _value);
+		value = current_.data();
+	}
+	if ( model_ == kHammingWeight ) {
+		leakage_ += kernels.PopCount(value, NULL, probe.size);
+	} else {
+		leakage_ += kernels.PopCount(value, previous, probe.size);
+		for (mp_size_t i = 0; i < probe.size; ++i) {
+			previous[i] = value[i];
+		}
+	}
+}
+
+/**
+ * @brief Copies the value of a probe into its limbs, cutting off the bits
+ *   beyond the length of the probe.
+ */
+void StdLogicVectorLeakage::Load(mp_limb_t * _dst, const Probe & _probe,
+		const StdLogicVector & _value) {
+	mp_size_t size = min<mp_size_t>(mpz_size(_value.getValue()), _probe.size);
+	unsigned int rem = _probe.length % GMP_NUMB_BITS;
+
+	if ( size > 0 ) {
+		mpn_copyi(_dst, mpz_limbs_read(_value.getValue()), size);
+	}
+	for (mp_size_t i = size; i < _probe.size; ++i) {
+		_dst[i] = 0;
+	}
+	if ( rem != 0 ) {
+		_dst[_probe.size - 1] &= (mp_limb_t(1) << rem) - 1;
+	}
+}
+
+/**
+ * @brief Completes the current cycle and stores its sample. Cycles beyond
+ *   the number of samples per trace are discarded.
+ */
+void StdLogicVectorLeakage::Clock() {
+	if ( cycle_ < getSampleCount() ) {
+		double sample = static_cast<double>(leakage_);
+
+		if ( noise_ > 0.0 ) {
+			sample += noise_ * Gaussian();
+		}
+		samples_[cycle_] = static_cast<float>(sample);
+	}
+	++cycle_;
+	leakage_ = 0;
+}
+
+/**
+ * @brief Returns a standard normally distributed random number (Marsaglia's
+ *   polar method, each pair of uniform numbers yielding two results).
+ */
+double StdLogicVectorLeakage::Gaussian() {
+	double u, v, s;
+
+	if ( hasSpare_ ) {
+		hasSpare_ = false;
+		return spare_;
+	}
+	do {
+		u = (Xoshiro256Plus(random_) >> 11) * 0x1.0p-52 - 1.0;
+		v = (Xoshiro256Plus(random_) >> 11) * 0x1.0p-52 - 1.0;
+		s = u * u + v * v;
+	} while (s >= 1.0 || s == 0.0);
+	s = sqrt(-2.0 * log(s) / s);
+	spare_    = v * s;
+	hasSpare_ = true;
+	return u * s;
+}
+
+
+// ****************************************************************************
+// Trace files
+// ****************************************************************************
+/**
+ * @brief Generates a set of traces using several threads and streams them
+ *   into a binary trace file.
+ *
+ * Each thread records its traces using a copy of the current
+ * StdLogicVectorLeakage (including its probes). For each trace, the copy is
+ * Reset() with the seed @p _seed + index, and @p _trace is called with the
+ * index of the trace to run the model (e.g., on the plaintext derived from
+ * that index). Since the traces are written in the order of their indices,
+ * the file does not depend on the number of threads.
+ *
+ * The file starts with a header of kHeaderSize bytes, followed by the
+ * samples of all traces (all values in host byte order):
+ *   - bytes 0-3: the magic "SLVT",
+ *   - bytes 4-5: the version of the format (1),
+ *   - bytes 6-7: the sample format (0 = float32, 1 = int16),
+ *   - bytes 8-11: the number of samples per trace (uint32),
+ *   - bytes 12-15: the scale of the samples (float32),
+ *   - bytes 16-23: the number of traces (uint64),
+ *   - bytes 24-27: the standard deviation of the noise (float32),
+ *   - bytes 28-31: reserved (0).
+ *
+ * @param _os The stream the trace file is written to.
+ * @param _traces The number of traces.
+ * @param _seed The seed of the noise of the first trace.
+ * @param _format The sample format.
+ * @param _scale The factor all samples are multiplied with (e.g., to use the
+ *   full range of int16 samples).
+ * @param _threads The number of threads (0 for one per hardware thread).
+ * @param _trace The model recording a single trace. It is called
+ *   concurrently and must therefore not modify any shared state. If it
+ *   throws, no further traces are generated, and the first exception is
+ *   rethrown once all threads have completed.
+ * @return True if all traces have been written successfully.
+ */
+bool StdLogicVectorLeakage::GenerateTraces(ostream & _os, size_t _traces,
+		uint64_t _seed, SampleFormat _format, float _scale, int _threads,
+		const TraceModel & _trace) const {
+	// Number of traces processed by a thread at once.
+	const size_t kChunkTraces = 256;
+	size_t sampleSize = (_format == kFloat32) ? sizeof(float) : sizeof(int16_t);
+	size_t traceSize  = samples_.size() * sampleSize;
+	size_t chunks = (_traces + kChunkTraces - 1) / kChunkTraces;
+	char header[kHeaderSize] = { 'S', 'L', 'V', 'T' };
+	uint16_t version = 1, format = static_cast<uint16_t>(_format);
+	uint32_t samples = static_cast<uint32_t>(samples_.size());
+	uint64_t traces = _traces;
+	float noise = static_cast<float>(noise_);
+	atomic<size_t> next(0);
+	mutex writing;
+	condition_variable written;
+	size_t turn = 0;
+	bool failed = false;
+	atomic<bool> aborted(false);
+	exception_ptr exception;
+
+	memcpy(header + 4, &version, sizeof(version));
+	memcpy(header + 6, &format, sizeof(format));
+	memcpy(header + 8, &samples, sizeof(samples));
+	memcpy(header + 12, &_scale, sizeof(_scale));
+	memcpy(header + 16, &traces, sizeof(traces));
+	memcpy(header + 24, &noise, sizeof(noise));
+	if ( !_os.write(header, kHeaderSize) ) {
+		return false;
+	}
+
+	// Each worker takes the next chunk of traces and, once all previous chunks
+	// have been written, appends its samples to the stream. A chunk failing
+	// to be generated still takes its turn, such that no worker waits forever.
+	auto worker = [&]() {
+		unique_ptr<StdLogicVectorLeakage> leakage;
+		vector<char> buffer;
+
+		for (size_t chunk = next++; chunk < chunks; chunk = next++) {
+			size_t first = chunk * kChunkTraces;
+			size_t count = min(kChunkTraces, _traces - first);
+			bool generated = false;
+
+			if ( !aborted ) {
+				try {
+					if ( !leakage ) {
+						leakage.reset(new StdLogicVectorLeakage(*this));
+						buffer.resize(kChunkTraces * traceSize);
+					}
+					for (size_t i = 0; i < count; ++i) {
+						leakage->Reset(_seed + first + i);
+						_trace(first + i, *leakage);
+						EncodeSamples(buffer.data() + i * traceSize,
+								leakage->getSamples(), samples_.size(), _format, _scale);
+					}
+					generated = true;
+				} catch (...) {
+					lock_guard<mutex> lock(writing);
+					if ( !exception ) {
+						exception = current_exception();
+					}
+					aborted = true;
+				}
+			}
+
+			unique_lock<mutex> lock(writing);
+			written.wait(lock, [&]() { return turn == chunk; });
+			if ( !generated ||
+					(!failed && !_os.write(buffer.data(), count * traceSize)) ) {
+				failed = true;
+			}
+			++turn;
+			written.notify_all();
+		}
+	};
+
+	if ( _threads <= 0 ) {
+		_threads = max<int>(thread::hardware_concurrency(), 1);
+	}
+	_threads = static_cast<int>(min<size_t>(_threads, max<size_t>(chunks, 1)));
+
+	// Threads which cannot be started merely leave more chunks to the others.
+	vector<thread> threads;
+	try {
+		for (int i = 1; i < _threads; ++i) {
+			threads.emplace_back(worker);
+		}
+	} catch (const system_error &) {
+	}
+	worker();
+	for (size_t i = 0; i < threads.size(); ++i) {
+		threads[i].join();
+	}
+	if ( exception ) {
+		rethrow_exception(exception);
+	}
+	return !failed;
+}
@@ -0,0 +1,698 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorModContext.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Modular arithmetic on StdLogicVectors for a fixed modulus
+ * @version 0.1
+ *
+ * All operations work on plain limb arrays of the size of the modulus. The
+ * products are computed by the arithmetic kernels of StdLogicVectorKernels,
+ * followed by either a Montgomery (REDC) or a Barrett reduction using the
+ * precomputed constants.
+ */
+#include <algorithm>
+#include <vector>
+#include <gmp.h>
+
+#include "StdLogicVectorModContext.h"
+#include "StdLogicVectorKernels.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+/**
+ * @brief Scratch limbs of an operation, kept on the stack for moduli of up to
+ *   kUnrolledLimbs limbs. Wider ones use limbs kept by the thread, unless
+ *   these are taken by an enclosing operation already.
+ */
+class ScratchLimbs {
+
+private:
+	static const mp_size_t kLocalLimbs = 8 * kUnrolledLimbs + 8;
+
+	static thread_local vector<mp_limb_t> tShared;
+	static thread_local bool tSharedTaken;
+
+	mp_limb_t local_[kLocalLimbs];
+	vector<mp_limb_t> heap_;
+	mp_limb_t * limbs_;
+	bool shared_;
+
+public:
+	explicit ScratchLimbs(mp_size_t _limbs) : limbs_(local_), shared_(false) {
+		if ( _limbs <= kLocalLimbs ) {
+			return;
+		}
+		if ( tSharedTaken ) {
+			heap_.resize(_limbs);
+			limbs_ = heap_.data();
+			return;
+		}
+		if ( tShared.size() < static_cast<size_t>(_limbs) ) {
+			tShared.resize(_limbs);
+		}
+		limbs_ = tShared.data();
+		shared_ = tSharedTaken = true;
+	}
+
+	~ScratchLimbs() {
+		if ( shared_ ) {
+			tSharedTaken = false;
+		}
+	}
+
+	ScratchLimbs(const ScratchLimbs &) = delete;
+	ScratchLimbs & operator=(const ScratchLimbs &) = delete;
+
+	mp_limb_t * get() {
+		return limbs_;
+	}
+};
+
+thread_local vector<mp_limb_t> ScratchLimbs::tShared;
+thread_local bool ScratchLimbs::tSharedTaken = false;
+
+/**
+ * @brief Copies the value of a GMP integer into @p _size limbs.
+ */
+static void ExportLimbs(vector<mp_limb_t> & _dst, mp_size_t _size,
+		mpz_srcptr _value) {
+	_dst.assign(_size, 0);
+	mpn_copyi(_dst.data(), mpz_limbs_read(_value),
+			min<mp_size_t>(mpz_size(_value), _size));
+}
+
+
+// ****************************************************************************
+// Constructors
+// ****************************************************************************
+/**
+ * @brief Creates a context for the given modulus and precomputes its
+ *   Montgomery (only for an odd modulus) and Barrett constants.
+ * @param _modulus The modulus n, which must not be zero. Its length
+ *   determines the length of all results.
+ */
+StdLogicVectorModContext::StdLogicVectorModContext(
+		const StdLogicVector & _modulus) : modulus_(_modulus), nPrime_(0)
+{
+	mpz_srcptr n = modulus_.getValue();
+	mpz_t tmp;
+
+	size_ = mpz_size(n);
+	mpz_init(tmp);
+
+	// Using 2^(128 * s) - 1 instead of 2^(128 * s) keeps the constant within
+	// s + 1 limbs even if n is a power of two.
+	mpz_setbit(tmp, 2 * GMP_NUMB_BITS * size_);
+	mpz_sub_ui(tmp, tmp, 1);
+	mpz_tdiv_q(tmp, tmp, n);
+	ExportLimbs(mu_, size_ + 1, tmp);
+	ExportLimbs(nBarrett_, size_ + 1, n);
+
+	if ( isOdd() ) {
+		// Newton's iteration doubles the number of correct bits of the inverse
+		// in each step, starting with three bits (n * n = 1 mod 8).
+		mp_limb_t n0  = mpz_getlimbn(n, 0);
+		mp_limb_t inv = n0;
+
+		for (int bits = 3; bits < GMP_NUMB_BITS; bits *= 2) {
+			inv *= 2 - n0 * inv;
+		}
+		nPrime_ = -inv;
+
+		mpz_set_ui(tmp, 0);
+		mpz_setbit(tmp, GMP_NUMB_BITS * size_);
+		mpz_mod(tmp, tmp, n);
+		ExportLimbs(r_, size_, tmp);
+		mpz_mul(tmp, tmp, tmp);
+		mpz_mod(tmp, tmp, n);
+		ExportLimbs(r2_, size_, tmp);
+	} else {
+		r_.assign(size_, 0);
+		r2_.assign(size_, 0);
+	}
+	mpz_clear(tmp);
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the modulus of the context.
+ */
+const StdLogicVector & StdLogicVectorModContext::getModulus() const {
+	return modulus_;
+}
+
+/**
+ * @brief Returns the length of the results (i.e., of the modulus vector).
+ */
+int StdLogicVectorModContext::getLength() const {
+	return modulus_.getLength();
+}
+
+/**
+ * @brief Determines whether the modulus is odd, as required by the Montgomery
+ *   operations.
+ */
+bool StdLogicVectorModContext::isOdd() const {
+	return mpz_odd_p(modulus_.getValue());
+}
+
+/**
+ * @brief Returns the Montgomery representation of one (i.e., R mod n).
+ */
+StdLogicVector StdLogicVectorModContext::getR() const {
+	return Store(r_.data());
+}
+
+/**
+ * @brief Returns R^2 mod n, which converts values into their Montgomery
+ *   representation.
+ */
+StdLogicVector StdLogicVectorModContext::getR2() const {
+	return Store(r2_.data());
+}
+
+/**
+ * @brief Returns n' = -n^-1 mod 2^64. Radix-2^k implementations use its k
+ *   least significant bits.
+ */
+unsigned long long StdLogicVectorModContext::getNPrime() const {
+	return nPrime_;
+}
+
+
+// ****************************************************************************
+// Modular operations
+// ****************************************************************************
+/**
+ * @brief Reduces a value modulo n.
+ * @param _operand The value to be reduced.
+ * @return @p _operand mod n.
+ */
+StdLogicVector StdLogicVectorModContext::Reduce(
+		const StdLogicVector & _operand) const {
+	ScratchLimbs scratch(size_);
+	mp_limb_t * result = scratch.get();
+
+	Load(result, _operand);
+	return Store(result);
+}
+
+/**
+ * @brief Modular addition.
+ * @return (@p _a + @p _b) mod n.
+ */
+StdLogicVector StdLogicVectorModContext::ModAdd(const StdLogicVector & _a,
+		const StdLogicVector & _b) const {
+	ScratchLimbs scratch(2 * size_);
+	mp_limb_t * a = scratch.get();
+	mp_limb_t * b = a + size_;
+
+	Load(a, _a);
+	Load(b, _b);
+	if ( AddLimbs(a, a, b, size_) != 0 ||
+			 mpn_cmp(a, ModulusLimbs(), size_) >= 0 ) {
+		mpn_sub_n(a, a, ModulusLimbs(), size_);
+	}
+	return Store(a);
+}
+
+/**
+ * @brief Modular subtraction.
+ * @return (@p _a - @p _b) mod n.
+ */
+StdLogicVector StdLogicVectorModContext::ModSub(const StdLogicVector & _a,
+		const StdLogicVector & _b) const {
+	ScratchLimbs scratch(2 * size_);
+	mp_limb_t * a = scratch.get();
+	mp_limb_t * b = a + size_;
+
+	Load(a, _a);
+	Load(b, _b);
+	if ( SubLimbs(a, a, b, size_) != 0 ) {
+		mpn_add_n(a, a, ModulusLimbs(), size_);
+	}
+	return Store(a);
+}
+
+/**
+ * @brief Modular multiplication using Barrett reduction. In contrast to
+ *   MontMul(), the operands and the result are ordinary values.
+ * @return (@p _a * @p _b) mod n.
+ */
+StdLogicVector StdLogicVectorModContext::ModMul(const StdLogicVector & _a,
+		const StdLogicVector & _b) const {
+	StdLogicVector result(getLength());
+
+	ModMul(_a, _b, result);
+	return result;
+}
+
+/**
+ * @brief Modular multiplication into an existing StdLogicVector (see
+ *   ModMul(const StdLogicVector &, const StdLogicVector &)).
+ * @param _a The multiplier.
+ * @param _b The multiplicand.
+ * @param _result Set to (@p _a * @p _b) mod n. May be @p _a or @p _b.
+ */
+void StdLogicVectorModContext::ModMul(const StdLogicVector & _a,
+		const StdLogicVector & _b, StdLogicVector & _result) const {
+	ScratchLimbs scratch(11 * size_ + 6);
+	mp_limb_t * product = scratch.get();
+	const mp_limb_t * a = Read(_a, product + 2 * size_);
+	const mp_limb_t * b = Read(_b, product + 3 * size_);
+
+	MulLimbs(product, a, size_, b, size_);
+	ReduceLimbs(product + 2 * size_, product, 2 * size_, product + 3 * size_);
+	Store(product + 2 * size_, _result);
+}
+
+/**
+ * @brief Modular exponentiation using a fixed window on top of the Montgomery
+ *   multiplication. The width of the window grows with the exponent, from 3
+ *   up to 6 bits. For an even modulus, the exponentiation is done by GMP.
+ * @param _base The base.
+ * @param _exponent The (unsigned) exponent.
+ * @return @p _base ^ @p _exponent mod n.
+ */
+StdLogicVector StdLogicVectorModContext::ModExp(const StdLogicVector & _base,
+		const StdLogicVector & _exponent) const {
+	StdLogicVector result(getLength());
+
+	ModExp(_base, _exponent, result);
+	return result;
+}
+
+/**
+ * @brief Modular exponentiation into an existing StdLogicVector (see
+ *   ModExp(const StdLogicVector &, const StdLogicVector &)).
+ * @param _base The base.
+ * @param _exponent The (unsigned) exponent.
+ * @param _result Set to @p _base ^ @p _exponent mod n. May be @p _base or
+ *   @p _exponent.
+ */
+void StdLogicVectorModContext::ModExp(const StdLogicVector & _base,
+		const StdLogicVector & _exponent, StdLogicVector & _result) const {
+	mpz_srcptr exponent = _exponent.getValue();
+	mp_size_t bits = (mpz_sgn(exponent) == 0) ? 0 :
+			mpz_sizeinbase(exponent, 2);
+	int windowBits = (bits <= 64) ? 3 : (bits <= 256) ? 4 :
+			(bits <= 1024) ? 5 : 6;
+	ScratchLimbs limbs(((1 << windowBits) + 3) * size_);
+	mp_limb_t * table   = limbs.get();
+	mp_limb_t * x       = table + (1 << windowBits) * size_;
+	mp_limb_t * scratch = x + size_;
+
+	if ( !isOdd() ) {
+		vector<mp_limb_t> power;
+		mpz_t result;
+
+		mpz_init(result);
+		mpz_powm(result, _base.getValue(), exponent, modulus_.getValue());
+		ExportLimbs(power, size_, result);
+		mpz_clear(result);
+		Store(power.data(), _result);
+		return;
+	}
+
+	// The table holds base^i in Montgomery representation.
+	mpn_copyi(table, r_.data(), size_);
+	Load(table + size_, _base);
+	MontMulLimbs(table + size_, table + size_, r2_.data(), scratch);
+	for (int i = 2; i < (1 << windowBits); ++i) {
+		MontMulLimbs(table + i * size_, table + (i - 1) * size_, table + size_,
+				scratch);
+	}
+
+	// The most significant window is taken from the table directly, which
+	// saves the squarings of the initial one.
+	mpn_copyi(x, r_.data(), size_);
+	for (mp_size_t window = (bits + windowBits - 1) / windowBits; window > 0;
+			--window) {
+		mp_size_t first = (window - 1) * windowBits;
+		unsigned int digit = 0;
+
+		for (int i = windowBits - 1; i >= 0; --i) {
+			digit = (digit << 1) | mpz_tstbit(exponent, first + i);
+		}
+		if ( first + windowBits >= bits ) {
+			mpn_copyi(x, table + digit * size_, size_);
+			continue;
+		}
+		for (int i = 0; i < windowBits; ++i) {
+			MontMulLimbs(x, x, x, scratch);
+		}
+		if ( digit != 0 ) {
+			MontMulLimbs(x, x, table + digit * size_, scratch);
+		}
+	}
+
+	// Leave the Montgomery representation by multiplying with one.
+	mpn_zero(table, size_);
+	table[0] = 1;
+	MontMulLimbs(x, x, table, scratch);
+	Store(x, _result);
+}
+
+/**
+ * @brief Computes the modular inverse.
+ * @param _a The value to be inverted.
+ * @param _result Set to the inverse (i.e., @p _a * @p _result = 1 mod n).
+ * @return False if @p _a has no inverse modulo n. In that case, @p _result is
+ *   left unchanged.
+ */
+bool StdLogicVectorModContext::ModInv(const StdLogicVector & _a,
+		StdLogicVector & _result) const {
+	mpz_t inverse;
+	bool exists;
+
+	mpz_init(inverse);
+	exists = mpz_invert(inverse, _a.getValue(), modulus_.getValue()) != 0;
+	if ( exists ) {
+		vector<mp_limb_t> limbs;
+
+		ExportLimbs(limbs, size_, inverse);
+		_result = Store(limbs.data());
+	}
+	mpz_clear(inverse);
+	return exists;
+}
+
+
+// ****************************************************************************
+// Montgomery operations
+// ****************************************************************************
+/**
+ * @brief Converts a value into its Montgomery representation.
+ * @return @p _a * R mod n.
+ */
+StdLogicVector StdLogicVectorModContext::ToMontgomery(
+		const StdLogicVector & _a) const {
+	ScratchLimbs scratch(3 * size_);
+	mp_limb_t * a = scratch.get();
+
+	Load(a, _a);
+	MontMulLimbs(a, a, r2_.data(), a + size_);
+	return Store(a);
+}
+
+/**
+ * @brief Converts a value from its Montgomery representation.
+ * @return @p _a * R^-1 mod n.
+ */
+StdLogicVector StdLogicVectorModContext::FromMontgomery(
+		const StdLogicVector & _a) const {
+	ScratchLimbs scratch(4 * size_);
+	mp_limb_t * a   = scratch.get();
+	mp_limb_t * one = a + size_;
+
+	Load(a, _a);
+	mpn_zero(one, size_);
+	one[0] = 1;
+	MontMulLimbs(a, a, one, one + size_);
+	return Store(a);
+}
+
+/**
+ * @brief Montgomery multiplication, computing the full product first and
+ *   reducing it a limb at a time afterwards.
+ * @return @p _a * @p _b * R^-1 mod n.
+ */
+StdLogicVector StdLogicVectorModContext::MontMul(const StdLogicVector & _a,
+		const StdLogicVector & _b) const {
+	StdLogicVector result(getLength());
+
+	MontMul(_a, _b, result);
+	return result;
+}
+
+/**
+ * @brief Montgomery multiplication into an existing StdLogicVector (see
+ *   MontMul(const StdLogicVector &, const StdLogicVector &)).
+ * @param _a The multiplier.
+ * @param _b The multiplicand.
+ * @param _result Set to @p _a * @p _b * R^-1 mod n. May be @p _a or @p _b.
+ */
+void StdLogicVectorModContext::MontMul(const StdLogicVector & _a,
+		const StdLogicVector & _b, StdLogicVector & _result) const {
+	ScratchLimbs scratch(5 * size_);
+	mp_limb_t * product = scratch.get();
+	const mp_limb_t * a = Read(_a, product + 2 * size_);
+	const mp_limb_t * b = Read(_b, product + 3 * size_);
+
+	MontMulLimbs(product + 4 * size_, a, b, product);
+	Store(product + 4 * size_, _result);
+}
+
+/**
+ * @brief Bit-true radix-2^k Montgomery multiplication, as commonly
+ *   implemented in hardware.
+ *
+ * In each of the 64 * s / k iterations, the next k bits a_i of @p _a
+ * (starting with the least significant ones) are processed:
+ *
+ *   T = (T + a_i * b + q * n) / 2^k, with q = (T + a_i * b) * n' mod 2^k.
+ *
+ * The intermediate value T always stays below 2n. A final subtraction of n
+ * yields the same result as MontMul().
+ *
+ * @param _a The multiplier.
+ * @param _b The multiplicand.
+ * @param _radixBits The number of bits k processed per iteration, which must
+ *   divide 64.
+ * @param _trace If not NULL, T is appended after each iteration (before the
+ *   final subtraction), each one bit longer than the modulus.
+ * @return @p _a * @p _b * R^-1 mod n, or an empty StdLogicVector for an
+ *   invalid @p _radixBits.
+ */
+StdLogicVector StdLogicVectorModContext::MontMulRadix(
+		const StdLogicVector & _a, const StdLogicVector & _b, int _radixBits,
+		vector<StdLogicVector> * _trace) const {
+	if ( _radixBits <= 0 || _radixBits > GMP_NUMB_BITS ||
+			 GMP_NUMB_BITS % _radixBits != 0 ) {
+		return StdLogicVector();
+	}
+	return MontMulRadix(_a, _b, _radixBits,
+			size_ * GMP_NUMB_BITS / _radixBits, _trace);
+}
+
+/**
+ * @brief Bit-true radix-2^k Montgomery multiplication (see above) with a
+ *   Montgomery radix of R = 2^(k * @p _iterations) instead of 2^(64 * s).
+ *
+ * This matches hardware running ceil(l / k) iterations for a modulus of l
+ * bits, for any k. E.g., a 255-bit modulus takes 51 iterations of 5 bits,
+ * such that R = 2^255.
+ *
+ * @param _a The multiplier.
+ * @param _b The multiplicand.
+ * @param _radixBits The number of bits k processed per iteration, from 1 to
+ *   64.
+ * @param _iterations The number of iterations, such that R = 2^(k *
+ *   @p _iterations) exceeds n.
+ * @param _trace If not NULL, T is appended after each iteration (before the
+ *   final subtraction), each one bit longer than the modulus.
+ * @return @p _a * @p _b * R^-1 mod n, or an empty StdLogicVector for an
+ *   invalid @p _radixBits or too few @p _iterations.
+ */
+StdLogicVector StdLogicVectorModContext::MontMulRadix(
+		const StdLogicVector & _a, const StdLogicVector & _b, int _radixBits,
+		int _iterations, vector<StdLogicVector> * _trace) const {
+	ScratchLimbs scratch(3 * size_ + 2);
+	mp_limb_t * a = scratch.get();
+	mp_limb_t * b = a + size_;
+	mp_limb_t * t = b + size_;
+	mp_limb_t mask;
+
+	if ( _radixBits <= 0 || _radixBits > GMP_NUMB_BITS || _iterations <= 0 ||
+			 static_cast<size_t>(_radixBits) * _iterations <
+			 mpz_sizeinbase(modulus_.getValue(), 2) ) {
+		return StdLogicVector();
+	}
+	mask = (_radixBits == GMP_NUMB_BITS) ? ~static_cast<mp_limb_t>(0) :
+			(static_cast<mp_limb_t>(1) << _radixBits) - 1;
+
+	Load(a, _a);
+	Load(b, _b);
+	mpn_zero(t, size_ + 2);
+	for (int i = 0; i < _iterations; ++i) {
+		mp_bitcnt_t bit = static_cast<mp_bitcnt_t>(i) * _radixBits;
+		mp_limb_t digit = StdLogicVector::ReadLimb(a, size_, bit) & mask;
+		mp_limb_t q;
+
+		mpn_add_1(t + size_, t + size_, 2, mpn_addmul_1(t, b, size_, digit));
+		q = (t[0] * nPrime_) & mask;
+		mpn_add_1(t + size_, t + size_, 2,
+				mpn_addmul_1(t, ModulusLimbs(), size_, q));
+		if ( _radixBits == GMP_NUMB_BITS ) {
+			mpn_copyi(t, t + 1, size_ + 1);
+			t[size_ + 1] = 0;
+		} else {
+			mpn_rshift(t, t, size_ + 2, _radixBits);
+		}
+
+		if ( _trace != NULL ) {
+			StdLogicVector step(getLength() + 1);
+
+			mpn_copyi(step.ModifyLimbs(size_ + 1), t, size_ + 1);
+			step.FinishLimbs(size_ + 1);
+			_trace->push_back(step);
+		}
+	}
+	if ( t[size_] != 0 || mpn_cmp(t, ModulusLimbs(), size_) >= 0 ) {
+		mpn_sub_n(t, t, ModulusLimbs(), size_);
+	}
+	return Store(t);
+}
+
+
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+/**
+ * @brief Returns the limbs of the modulus.
+ */
+const mp_limb_t * StdLogicVectorModContext::ModulusLimbs() const {
+	return mpz_limbs_read(modulus_.getValue());
+}
+
+/**
+ * @brief Copies an operand into limbs of the size of the modulus, reducing it
+ *   if it is not below the modulus.
+ */
+void StdLogicVectorModContext::Load(mp_limb_t * _dst,
+		const StdLogicVector & _operand) const {
+	mpz_srcptr value = _operand.getValue();
+	mp_size_t size   = mpz_size(value);
+
+	if ( size > size_ || (size == size_ &&
+			 mpn_cmp(mpz_limbs_read(value), ModulusLimbs(), size_) >= 0) ) {
+		ScratchLimbs scratch(8 * size_ + 6);
+
+		ReduceLimbs(_dst, mpz_limbs_read(value), size, scratch.get());
+		return;
+	}
+	mpn_copyi(_dst, mpz_limbs_read(value), size);
+	mpn_zero(_dst + size, size_ - size);
+}
+
+/**
+ * @brief Provides the limbs of an operand in the size of the modulus. Only if
+ *   the operand has fewer limbs or is not below the modulus, it is loaded into
+ *   the scratch limbs (see Load()).
+ * @param _operand The operand to be read.
+ * @param _scratch Holds the loaded operand if required.
+ * @return The limbs of the reduced operand.
+ */
+const mp_limb_t * StdLogicVectorModContext::Read(
+		const StdLogicVector & _operand, mp_limb_t * _scratch) const {
+	mpz_srcptr value = _operand.getValue();
+
+	if ( static_cast<mp_size_t>(mpz_size(value)) == size_ &&
+			 mpn_cmp(mpz_limbs_read(value), ModulusLimbs(), size_) < 0 ) {
+		return mpz_limbs_read(value);
+	}
+	Load(_scratch, _operand);
+	return _scratch;
+}
+
+/**
+ * @brief Creates a StdLogicVector of the length of the modulus from limbs of
+ *   the size of the modulus.
+ */
+StdLogicVector StdLogicVectorModContext::Store(const mp_limb_t * _src) const {
+	StdLogicVector result(getLength());
+
+	mpn_copyi(result.ModifyLimbs(size_), _src, size_);
+	result.FinishLimbs(size_);
+	return result;
+}
+
+/**
+ * @brief Stores limbs of the size of the modulus in an existing
+ *   StdLogicVector, which gets the length of the modulus.
+ */
+void StdLogicVectorModContext::Store(const mp_limb_t * _src,
+		StdLogicVector & _result) const {
+	mpn_copyi(_result.ModifyLimbs(size_), _src, size_);
+	_result.FinishLimbs(size_);
+	_result.length_ = getLength();
+}
+
+/**
+ * @brief Montgomery multiplication of two values below n.
+ * @param _dst Set to @p _a * @p _b * R^-1 mod n. May be identical to @p _a or
+ *   @p _b.
+ * @param _scratch Twice the size of the modulus.
+ */
+void StdLogicVectorModContext::MontMulLimbs(mp_limb_t * _dst,
+		const mp_limb_t * _a, const mp_limb_t * _b, mp_limb_t * _scratch) const {
+	::MontMulLimbs(_dst, _a, _b, ModulusLimbs(), nPrime_, size_, _scratch);
+}
+
+/**
+ * @brief Reduces a value of @p _size limbs modulo n. Values of up to twice
+ *   the size of the modulus are reduced using Barrett's method, larger ones by
+ *   a division.
+ * @param _scratch Eight times the size of the modulus plus six limbs.
+ */
+void StdLogicVectorModContext::ReduceLimbs(mp_limb_t * _dst,
+		const mp_limb_t * _src, mp_size_t _size, mp_limb_t * _scratch) const {
+	const mp_limb_t * n = ModulusLimbs();
+	mp_size_t k = size_;
+
+	if ( _size > 2 * k ) {
+		vector<mp_limb_t> quotient(_size - k + 1);
+
+		mpn_tdiv_qr(quotient.data(), _dst, 0, _src, _size, n, k);
+		return;
+	}
+
+	mp_limb_t * x       = _scratch;
+	mp_limb_t * q       = x + 2 * k;
+	mp_limb_t * r       = q + k + 1;
+	mp_limb_t * product = r + k + 1;
+
+	if ( _size < 2 * k ) {
+		mpn_copyi(x, _src, _size);
+		mpn_zero(x + _size, 2 * k - _size);
+		_src = x;
+	}
+
+	// q = floor(floor(x / 2^(64(k-1))) * mu / 2^(64(k+1))) underestimates the
+	// quotient by at most two. Only the upper half of the product is needed,
+	// whose truncation adds at most one. As the remainder is below 2^(64(k+1)),
+	// only the lower half of q * n is needed.
+	MulHighLimbs(q, _src + k - 1, mu_.data(), k + 1, product);
+	MulLowLimbs(r, q, nBarrett_.data(), k + 1, product);
+	mpn_sub_n(r, _src, r, k + 1);
+	while ( r[k] != 0 || mpn_cmp(r, n, k) >= 0 ) {
+		r[k] -= mpn_sub_n(r, r, n, k);
+	}
+	mpn_copyi(_dst, r, k);
+}
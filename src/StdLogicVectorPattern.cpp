@@ -0,0 +1,166 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorPattern.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief An expected StdLogicVector value with per-bit don't cares
+ * @version 0.1
+ */
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <gmp.h>
+
+#include "StdLogicVectorPattern.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Constructors
+// ****************************************************************************
+/**
+ * @brief Creates an empty StdLogicVectorPattern.
+ */
+StdLogicVectorPattern::StdLogicVectorPattern()
+{
+}
+
+/**
+ * @brief Creates a StdLogicVectorPattern comparing all bits of a value.
+ * @param _value The expected value.
+ */
+StdLogicVectorPattern::StdLogicVectorPattern(const StdLogicVector & _value) :
+		value_(_value)
+{
+	int length = _value.getLength();
+
+	care_ = StdLogicVector(string(max((length + 3) / 4, 1), 'F'), 16, length);
+	care_.TruncateAfter(length);
+	value_.And(care_);
+}
+
+/**
+ * @brief Creates a StdLogicVectorPattern from an expected value and a care
+ *   mask.
+ * @param _value The expected value.
+ * @param _care The care mask, holding a 1 for each bit to be compared. Its
+ *   length is adjusted to the one of @p _value.
+ */
+StdLogicVectorPattern::StdLogicVectorPattern(const StdLogicVector & _value,
+		const StdLogicVector & _care) : value_(_value), care_(_care)
+{
+	care_.TruncateAfter(_value.getLength());
+	value_.And(care_);
+}
+
+/**
+ * @brief Creates a StdLogicVectorPattern from a string, where each digit
+ *   @c - denotes a don't care (e.g., "1--0"). Like the digits of a
+ *   StdLogicVector, a pattern with fewer digits than @p _length is extended
+ *   with leading zeros (which are compared).
+ * @param _pattern The digits of the expected value.
+ * @param _base The base of the digits (2, 4, 8, 16 or 32), such that each
+ *   digit @c - covers the same number of bits.
+ * @param _length The length of the pattern in bits.
+ * @throw invalid_argument If @p _base is not a supported base.
+ */
+StdLogicVectorPattern::StdLogicVectorPattern(string_view _pattern, int _base,
+		unsigned int _length)
+{
+	const char * kDigits = "0123456789ABCDEFGHIJKLMNOPQRSTUV";
+	int bitsPerDigit;
+	string value(_pattern), care(_pattern);
+	size_t digits;
+
+	if ( _base < 2 || _base > 32 || (_base & (_base - 1)) != 0 ) {
+		throw invalid_argument("StdLogicVectorPattern: unsupported base");
+	}
+	bitsPerDigit = __builtin_ctz(_base);
+	for (size_t i = 0; i < _pattern.size(); ++i) {
+		value[i] = (_pattern[i] == '-') ? '0' : _pattern[i];
+		care[i]  = (_pattern[i] == '-') ? '0' : kDigits[_base - 1];
+	}
+	// All bits not covered by a '-' digit are compared, including the implied
+	// leading zeros.
+	digits = (_length + bitsPerDigit - 1) / bitsPerDigit;
+	if ( care.size() < digits ) {
+		care.insert(0, digits - care.size(), kDigits[_base - 1]);
+	}
+	value_ = StdLogicVector(value, _base, _length);
+	care_  = StdLogicVector(care, _base, _length);
+	care_.TruncateAfter(_length);
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the length of the pattern in bits.
+ */
+int StdLogicVectorPattern::getLength() const {
+	return value_.getLength();
+}
+
+/**
+ * @brief Returns the expected value (with all don't-care bits being 0).
+ */
+const StdLogicVector & StdLogicVectorPattern::getValue() const {
+	return value_;
+}
+
+/**
+ * @brief Returns the care mask, holding a 1 for each bit to be compared.
+ */
+const StdLogicVector & StdLogicVectorPattern::getCare() const {
+	return care_;
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+/**
+ * @brief Checks whether a value matches the pattern.
+ * @param _actual The value to be checked.
+ * @return True if @p _actual has the length of the pattern and agrees with
+ *   the expected value in all bits set in the care mask.
+ */
+bool StdLogicVectorPattern::Matches(const StdLogicVector & _actual) const {
+	return _actual.MatchesWithMask(value_, care_);
+}
+
+/**
+ * @brief Converts the pattern into its binary representation.
+ * @return The bits of the pattern (most significant bit first), each
+ *   don't-care bit being a @c -.
+ */
+string StdLogicVectorPattern::ToString() const {
+	string result(getLength(), '-');
+
+	for (int i = 0; i < getLength(); ++i) {
+		if ( care_.TestBit(i) ) {
+			result[getLength() - 1 - i] = value_.TestBit(i) ? '1' : '0';
+		}
+	}
+	return result;
+}
@@ -33,10 +33,33 @@
 // testing of the shared library.
 #ifdef TEST_
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include "limits.h"
 
 #include "StdLogicVector.h"
+#include "StdLogicVectorView.h"
+#include "StdLogicVectorArray.h"
+#include "StdLogicVectorBitslice.h"
+#include "StdLogicVectorExpression.h"
+#include "StdLogicVectorPattern.h"
+#include "StdLogicVectorModContext.h"
+#include "StdLogicVectorLeakage.h"
+#include "StdLogicVectorArena.h"
+#include "StdLogicVectorThreadPool.h"
+#include "StdULogicVector.h"
+#include "StdLogicVectorKernels.h"
+#include "FixedLogicVector.h"
 #include "gtest/gtest.h"
 
 using namespace std;
@@ -197,6 +220,182 @@ TEST(StdLogicVectorUtils, ToByteArray) {
 	dut 		= StdLogicVector("A0B1C2D3", 16, 32);
 	dut.ToByteArray(actOutp);
 	EXPECT_EQ(expOutp[0], actOutp[0]);
+
+	// Test case 2: An odd number of nibbles is right-aligned.
+	dut 		= StdLogicVector("ABC", 16, 12);
+	dut.ToByteArray(actOutp);
+	EXPECT_EQ(0x0A, actOutp[0]);
+	EXPECT_EQ(0xBC, actOutp[1]);
+}
+
+// Test parsing StdLogicVectors from strings of digits.
+TEST(StdLogicVectorUtils, FromChars) {
+
+	string hex    = "0123456789abcdefABCDEF0123456789aBcDeF0f1e2d3c4b5a69788796a5b4c3d2e1f0";
+	string binary = string(130, '0') + "1101" + string(70, '1') + "0110";
+	StdLogicVector act;
+	from_chars_result result;
+	mpz_t exp;
+
+	// Test case 1: All bases match the conversion of GMP.
+	mpz_init(exp);
+	for (int base = 2; base <= 62; ++base) {
+		// The lower-case 'f' has a value of 41 for bases beyond 36.
+		const string & digits = (base < 16) ? binary : hex;
+		if ( base > 36 && base <= 41 ) {
+			continue;
+		}
+		result = StdLogicVector::FromChars(digits.data(), digits.data() +
+				digits.size(), base, 1024, act);
+		mpz_set_str(exp, digits.c_str(), base);
+		EXPECT_EQ(errc(), result.ec);
+		EXPECT_EQ(0, mpz_cmp(exp, act.getValue()));
+		EXPECT_EQ(1024, act.getLength());
+	}
+	mpz_clear(exp);
+
+	// Test case 2: Invalid digits clear the result.
+	act    = StdLogicVector(0x55, 8);
+	hex    = "1f" + string(40, 'a') + "x9";
+	result = StdLogicVector::FromChars(hex.data(), hex.data() + hex.size(), 16,
+			256, act);
+	EXPECT_EQ(errc::invalid_argument, result.ec);
+	EXPECT_EQ(hex.data() + 42, result.ptr);
+	EXPECT_EQ(StdLogicVector(0, 256), act);
+	binary = "1012";
+	result = StdLogicVector::FromChars(binary.data(), binary.data() + 4, 2, 8,
+			act);
+	EXPECT_EQ(errc::invalid_argument, result.ec);
+	EXPECT_EQ(binary.data() + 3, result.ptr);
+	result = StdLogicVector::FromChars(hex.data(), hex.data(), 16, 8, act);
+	EXPECT_EQ(errc::invalid_argument, result.ec);
+
+	// Test case 3: Values exceeding the length.
+	hex    = "001FF";
+	result = StdLogicVector::FromChars(hex.data(), hex.data() + 5, 16, 8, act);
+	EXPECT_EQ(errc::result_out_of_range, result.ec);
+	result = StdLogicVector::FromChars(hex.data(), hex.data() + 5, 16, 9, act);
+	EXPECT_EQ(errc(), result.ec);
+	EXPECT_EQ(StdLogicVector(0x1FF, 9), act);
+
+	// Test case 4: The constructors still accept whatever GMP accepts.
+	EXPECT_EQ(StdLogicVector(0xA0B1, 16), StdLogicVector("A0 B1", 16, 16));
+	EXPECT_EQ(StdLogicVector(0x1F, 8), StdLogicVector("0x1f", 0, 8));
+}
+
+// Test formatting StdLogicVectors into caller-provided buffers.
+TEST(StdLogicVectorUtils, FormatTo) {
+
+	StdLogicVector dut("1F", 16, 10);
+	char buf[32];
+	to_chars_result result;
+
+	// Test case 1: Padding in different bases.
+	EXPECT_EQ(3u, dut.FormatTo(buf, sizeof(buf), 16, true));
+	EXPECT_STREQ("01f", buf);
+	EXPECT_EQ(3u, dut.FormatTo(buf, sizeof(buf), -16, true));
+	EXPECT_STREQ("01F", buf);
+	EXPECT_EQ(10u, dut.FormatTo(buf, sizeof(buf), 2, true));
+	EXPECT_STREQ("0000011111", buf);
+	EXPECT_EQ(4u, dut.FormatTo(buf, sizeof(buf), 8, true));
+	EXPECT_STREQ("0037", buf);
+	EXPECT_EQ(4u, dut.FormatTo(buf, sizeof(buf), 10, true));
+	EXPECT_STREQ("0031", buf);
+	EXPECT_EQ(2u, dut.FormatTo(buf, sizeof(buf), 10, false));
+	EXPECT_STREQ("31", buf);
+
+	// Test case 2: Buffers too small and unsupported bases.
+	EXPECT_EQ(0u, dut.FormatTo(buf, 3, 16, true));
+	EXPECT_EQ(0u, dut.FormatTo(buf, sizeof(buf), 1, true));
+	result = dut.ToChars(buf, buf + 2, 2, false);
+	EXPECT_EQ(errc::value_too_large, result.ec);
+	result = dut.ToChars(buf, buf + 5, 2, false);
+	EXPECT_EQ(errc(), result.ec);
+	EXPECT_EQ("11111", string(buf, result.ptr));
+
+	// Test case 3: The padding matches the number of digits of the largest
+	// value of the respective length.
+	for (int length = 1; length < 1000; length += 7) {
+		StdLogicVector ones(string(length, '1'), 2, length);
+		for (int base = 2; base <= 62; ++base) {
+			EXPECT_EQ(ones.ToString(base, false), ones.ToString(base, true));
+		}
+	}
+
+	// Test case 4: All bases match the conversion of GMP.
+	StdLogicVector wide("123456789abcdef0fedcba987654321f0e1d2c3b4a5968778695a4b3"
+			"c2d1e0f", 16, 250);
+	for (int base = -36; base <= 62; ++base) {
+		if ( base >= -1 && base <= 1 ) {
+			continue;
+		}
+		char * exp = mpz_get_str(NULL, base, wide.getValue());
+		EXPECT_EQ(string(exp), wide.ToString(base, false));
+		free(exp);
+	}
+}
+
+// Test exporting StdLogicVectors into byte and word arrays.
+TEST(StdLogicVectorUtils, ToBytes) {
+
+	StdLogicVector dut("1A0B1C2D3E4F5061728394A5B6C7D8E9F", 16, 132);
+	uint8_t bytes[17];
+	uint32_t words32[5];
+	uint64_t words64[3];
+
+	// Test case 1: Both byte orders.
+	EXPECT_TRUE(dut.ToBytes(bytes, 17, StdLogicVector::kBigEndian));
+	EXPECT_EQ(0x01, bytes[0]);
+	EXPECT_EQ(0xA0, bytes[1]);
+	EXPECT_EQ(0x9F, bytes[16]);
+	EXPECT_TRUE(dut.ToBytes(bytes, 17, StdLogicVector::kLittleEndian));
+	EXPECT_EQ(0x9F, bytes[0]);
+	EXPECT_EQ(0x8E, bytes[1]);
+	EXPECT_EQ(0x01, bytes[16]);
+
+	// Test case 2: Words.
+	EXPECT_TRUE(dut.ToWords(words32, 5, StdLogicVector::kBigEndian));
+	EXPECT_EQ(0x1u, words32[0]);
+	EXPECT_EQ(0x6C7D8E9Fu, words32[4]);
+	EXPECT_TRUE(dut.ToWords(words64, 3, StdLogicVector::kLittleEndian));
+	EXPECT_EQ(0x28394A5B6C7D8E9Full, words64[0]);
+	EXPECT_EQ(0xA0B1C2D3E4F50617ull, words64[1]);
+	EXPECT_EQ(0x1ull, words64[2]);
+
+	// Test case 3: Buffers too small and bits beyond the length.
+	EXPECT_FALSE(dut.ToBytes(bytes, 16, StdLogicVector::kBigEndian));
+	dut = StdLogicVector(0xFFFF, 12);
+	EXPECT_TRUE(dut.ToBytes(bytes, 2, StdLogicVector::kBigEndian));
+	EXPECT_EQ(0x0F, bytes[0]);
+	EXPECT_EQ(0xFF, bytes[1]);
+}
+
+// Test importing StdLogicVectors from byte and word arrays.
+TEST(StdLogicVectorUtils, FromBytes) {
+
+	uint8_t bytes[40];
+	uint64_t words[5];
+	StdLogicVector act;
+
+	for (int i = 0; i < 40; ++i) {
+		bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+	}
+	StdLogicVector exp = StdLogicVector(bytes, 40, 320);
+
+	// Test case 1: Round trips across the inline limit.
+	act = StdLogicVector::FromBytes(bytes, 40, StdLogicVector::kBigEndian, 320);
+	EXPECT_EQ(exp, act);
+	act.ToBytes(bytes, 40, StdLogicVector::kLittleEndian);
+	act = StdLogicVector::FromBytes(bytes, 40, StdLogicVector::kLittleEndian,
+			320);
+	EXPECT_EQ(exp, act);
+	act.ToWords(words, 5, StdLogicVector::kBigEndian);
+	act = StdLogicVector::FromWords(words, 5, StdLogicVector::kBigEndian, 320);
+	EXPECT_EQ(exp, act);
+
+	// Test case 2: Bits beyond the length are dropped.
+	act = StdLogicVector::FromWords(words, 5, StdLogicVector::kBigEndian, 100);
+	EXPECT_EQ(exp.Extract(99, 0), act);
 }
 
 
@@ -552,6 +751,56 @@ TEST(StdLogicVectorOperations, TruncateBits) {
 
 }
 
+// Test the StdLogicVector::TruncateAfter() function on wide vectors.
+TEST(StdLogicVectorOperations, TruncateBitsWide) {
+
+	StdLogicVector dut, expOutp;
+
+	dut			= StdLogicVector("5" + string(80, 'F'), 16, 324);
+	expOutp	= StdLogicVector("3" + string(32, 'F'), 16, 130);
+	EXPECT_EQ(expOutp, dut.TruncateAfter(130));
+	EXPECT_EQ(expOutp, dut.TruncateAfter(300).TruncateAfter(130));
+}
+
+// Test the wrap-around mode of StdLogicVectors.
+TEST(StdLogicVectorOperations, Wrapping) {
+
+	StdLogicVector dut;
+
+	// Test case 1: Shifting left
+	dut = StdLogicVector("10110011", 2, 8);
+	dut.setWrapping(true);
+	EXPECT_EQ(StdLogicVector("10011000", 2, 8), dut.ShiftLeft(3));
+	EXPECT_EQ(StdLogicVector(0, 8), dut.ShiftLeft(64));
+
+	// Test case 2: Shifting left across limbs
+	dut = StdLogicVector(string(50, 'F'), 16, 200);
+	dut.setWrapping(true);
+	dut.ShiftLeft(70);
+	EXPECT_EQ(StdLogicVector(string(32, 'F') + "C" + string(17, '0'), 16, 200),
+			dut);
+
+	// Test case 3: Additions never grow the length.
+	dut = StdLogicVector("11111111", 2, 8);
+	dut.setWrapping(true);
+	dut.Add(StdLogicVector(2, 8), false);
+	EXPECT_EQ(StdLogicVector(1, 8), dut);
+
+	// Test case 4: Bitwise operations with longer operands
+	dut = StdLogicVector("0000", 2, 4);
+	dut.setWrapping(true);
+	EXPECT_EQ(StdLogicVector("1111", 2, 4),
+			dut.Or(StdLogicVector("11111111", 2, 8)));
+	EXPECT_EQ(StdLogicVector("0101", 2, 4),
+			dut.Xor(StdLogicVector("01011010", 2, 8)));
+
+	// Test case 5: Enabling the mode truncates the value.
+	dut = StdLogicVector("11111111", 2, 8);
+	dut.ShiftLeft(4);
+	dut.setWrapping(true);
+	EXPECT_EQ(StdLogicVector("11110000", 2, 8), dut);
+}
+
 // Test the StdLogicVector::ReplaceBits() function.
 TEST(StdLogicVectorOperations, ReplaceBits) {
 
@@ -593,6 +842,89 @@ TEST(StdLogicVectorOperations, ReplaceBits) {
 	EXPECT_EQ(expOutp, actOutp);
 }
 
+// Test the StdLogicVector::ReplaceBits() function on wide vectors.
+TEST(StdLogicVectorOperations, ReplaceBitsWide) {
+
+	StdLogicVector dut, repl, expOutp;
+
+	// Test case 1: Replacement crossing several limbs
+	dut			= StdLogicVector(string(75, 'F'), 16, 300);
+	repl		= StdLogicVector(string(25, '0'), 16, 100);
+	expOutp	= StdLogicVector(string(40, 'F') + string(25, '0') + "FFFFFFFF" +
+			"FF", 16, 300);
+	dut.ReplaceBits(40, repl);
+	EXPECT_EQ(expOutp, dut);
+
+	// Test case 2: Replacement exceeding the length of the StdLogicVector
+	dut			= StdLogicVector("00000000", 2, 8);
+	repl		= StdLogicVector("110101", 2, 6);
+	expOutp	= StdLogicVector("10100000", 2, 8);
+	dut.ReplaceBits(5, repl);
+	EXPECT_EQ(expOutp, dut);
+
+	// Test case 3: Replacing bits with the StdLogicVector itself
+	dut			= StdLogicVector("00001011", 2, 8);
+	expOutp	= StdLogicVector("10111011", 2, 8);
+	dut.ReplaceBits(4, dut);
+	EXPECT_EQ(expOutp, dut);
+}
+
+// Test the StdLogicVector::Extract() function.
+TEST(StdLogicVectorOperations, Extract) {
+
+	StdLogicVector dut;
+
+	// Test case 1
+	dut = StdLogicVector("010011001010001111", 2, 18);
+	EXPECT_EQ(StdLogicVector("01100101", 2, 8), dut.Extract(14, 7));
+	EXPECT_EQ(StdLogicVector("1111", 2, 4), dut.Extract(3, 0));
+
+	// Test case 2: Extraction crossing limbs and beyond the value
+	dut = StdLogicVector("ABCDEF0123456789" "FEDCBA9876543210", 16, 128);
+	EXPECT_EQ(StdLogicVector("789FE", 16, 20), dut.Extract(75, 56));
+	EXPECT_EQ(StdLogicVector("0AB", 16, 12), dut.Extract(131, 120));
+}
+
+// Test the StdLogicVector::Concat() function and the concatenation operator.
+TEST(StdLogicVectorOperations, Concat) {
+
+	StdLogicVector a, b, c, expOutp, actOutp;
+
+	a				= StdLogicVector("101", 2, 3);
+	b				= StdLogicVector("0011", 2, 4);
+	c				= StdLogicVector("1", 2, 1);
+	expOutp	= StdLogicVector("10100111", 2, 8);
+
+	// Test case 1: Variadic concatenation and concatenation operator
+	EXPECT_EQ(expOutp, StdLogicVector::Concat(a, b, c));
+	actOutp = a & b & c;
+	EXPECT_EQ(expOutp, actOutp);
+	EXPECT_EQ(StdLogicVector("1010011", 2, 7), StdLogicVector(a & b));
+
+	// Test case 2: Wide operands crossing limbs
+	a				= StdLogicVector(string(25, 'A'), 16, 100);
+	b				= StdLogicVector(string(30, '5'), 16, 120);
+	expOutp	= StdLogicVector(string(25, 'A') + string(30, '5') +
+			string(25, 'A'), 16, 320);
+	EXPECT_EQ(expOutp, StdLogicVector::Concat(a, b, a));
+	actOutp = a & b & a;
+	EXPECT_EQ(expOutp, actOutp);
+
+	// Test case 3: Bits beyond the length of an operand are ignored.
+	a				= StdLogicVector("FF", 16, 4);
+	EXPECT_EQ(StdLogicVector("F3", 16, 8), StdLogicVector::Concat(a,
+			StdLogicVector(3, 4)));
+
+	// Test case 4: A pending concatenation can neither be copied nor converted
+	// or extended once it is stored.
+	EXPECT_FALSE(is_copy_constructible<StdLogicVectorConcat>::value);
+	EXPECT_FALSE(is_move_constructible<StdLogicVectorConcat>::value);
+	EXPECT_FALSE((is_convertible<StdLogicVectorConcat &,
+			StdLogicVector>::value));
+	EXPECT_TRUE((is_convertible<StdLogicVectorConcat &&,
+			StdLogicVector>::value));
+}
+
 // Test the StdLogicVector::PadRightZeros() function.
 TEST(StdLogicVectorOperations, PadRightZeros) {
 
@@ -636,6 +968,125 @@ TEST(StdLogicVectorOperations, ReverseBitOrder) {
 
 }
 
+// Test the StdLogicVector::ReverseBitOrder() function on wide vectors.
+TEST(StdLogicVectorOperations, ReverseBitOrderWide) {
+
+	StdLogicVector dut, expOutp;
+	string binary;
+	int widths[] = {64, 65, 127, 128, 300, 1024, 1031};
+
+	for (unsigned int i = 0; i < sizeof(widths)/sizeof(widths[0]); ++i) {
+		binary.clear();
+		for (int j = 0; j < widths[i]; ++j) {
+			binary.push_back((rand() % 2) ? '1' : '0');
+		}
+		dut			= StdLogicVector(binary, 2, widths[i]);
+		expOutp	= StdLogicVector(string(binary.rbegin(), binary.rend()), 2,
+				widths[i]);
+		EXPECT_EQ(expOutp, dut.ReverseBitOrder());
+	}
+}
+
+// Rotates a StdLogicVector to the left using shifts, as done before
+// StdLogicVector::RotateLeft() was available.
+static StdLogicVector RotateLeftReference(const StdLogicVector & _input,
+		int _bits) {
+	int length = _input.getLength();
+	int bits = ((_bits % length) + length) % length;
+	StdLogicVector low(_input), high(_input);
+
+	low.ShiftLeft(bits).TruncateAfter(length);
+	high.ShiftRight(length - bits);
+	return low.Or(high);
+}
+
+// Test the StdLogicVector::RotateLeft() and StdLogicVector::RotateRight()
+// functions.
+TEST(StdLogicVectorOperations, Rotate) {
+
+	int widths[] = {1, 8, 32, 63, 64, 65, 100, 256, 300, 1600};
+	int amounts[] = {0, 1, 7, 31, 64, 65, 200, 1599, 1600, 1601, -5};
+
+	EXPECT_EQ(StdLogicVector("10000111", 2, 8), StdLogicVector("00011110", 2, 8)
+			.RotateRight(2));
+	EXPECT_EQ(StdLogicVector("01111000", 2, 8), StdLogicVector("00011110", 2, 8)
+			.RotateLeft(2));
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		string hex;
+
+		for (int j = 0; j < (widths[w] + 3) / 4; ++j) {
+			hex.push_back("0123456789ABCDEF"[rand() % 16]);
+		}
+		StdLogicVector a = StdLogicVector(hex, 16, widths[w])
+				.TruncateAfter(widths[w]);
+
+		for (unsigned int i = 0; i < sizeof(amounts)/sizeof(amounts[0]); ++i) {
+			EXPECT_EQ(RotateLeftReference(a, amounts[i]),
+					StdLogicVector(a).RotateLeft(amounts[i]))
+					<< widths[w] << ", " << amounts[i];
+			EXPECT_EQ(RotateLeftReference(a, -amounts[i]),
+					StdLogicVector(a).RotateRight(amounts[i]))
+					<< widths[w] << ", " << amounts[i];
+		}
+		// Bits beyond the length (e.g., after a shift) are not rotated in.
+		StdLogicVector shifted = StdLogicVector(a).ShiftLeft(1);
+		StdLogicVector expOutp = RotateLeftReference(
+				StdLogicVector(shifted).TruncateAfter(widths[w]), 3);
+		EXPECT_EQ(expOutp, shifted.RotateLeft(3)) << widths[w];
+	}
+}
+
+// Test the bit counting functions against loops over StdLogicVector::TestBit().
+TEST(StdLogicVectorOperations, BitCounting) {
+
+	int widths[] = {1, 8, 63, 64, 65, 100, 256, 1000};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		int n = widths[w];
+
+		for (int i = 0; i < 10; ++i) {
+			string hex1, hex2;
+
+			for (int j = 0; j < (n + 3) / 4; ++j) {
+				hex1.push_back("0123456789ABCDEF"[rand() % 16]);
+				hex2.push_back("0123456789ABCDEF"[rand() % 16]);
+			}
+			// Use a zero vector and vectors of a single bit as well.
+			if ( i == 0 ) {
+				hex1 = string(hex1.size(), '0');
+			}
+			StdLogicVector a = StdLogicVector(hex1, 16, n).TruncateAfter(n);
+			StdLogicVector b = StdLogicVector(hex2, 16, n).TruncateAfter(n / 2 + 1);
+			if ( i == 1 || i == 2 ) {
+				a = StdLogicVector(1, n).ShiftLeft((i == 1) ? 0 : n - 1);
+			}
+			int count = 0, distance = 0, lowest = -1, highest = -1;
+
+			for (int j = 0; j < n; ++j) {
+				count += a.TestBit(j);
+				distance += a.TestBit(j) ^ b.TestBit(j);
+				if ( a.TestBit(j) ) {
+					lowest  = (lowest < 0) ? j : lowest;
+					highest = j;
+				}
+			}
+			EXPECT_EQ(count, a.PopCount()) << n;
+			EXPECT_EQ(count & 1, a.Parity()) << n;
+			EXPECT_EQ((highest < 0) ? n : n - 1 - highest, a.CountLeadingZeros());
+			EXPECT_EQ((lowest < 0) ? n : lowest, a.CountTrailingZeros()) << n;
+			EXPECT_EQ(lowest + 1, a.FindFirstSet()) << n;
+			EXPECT_EQ(distance, a.HammingDistance(b)) << n;
+			EXPECT_EQ(distance, b.HammingDistance(a)) << n;
+
+			// Bits shifted beyond the length are not counted.
+			StdLogicVector shifted = StdLogicVector(a).ShiftLeft(3);
+			EXPECT_EQ(count - (a.Extract(n - 1, max(n - 3, 0)).PopCount()),
+					shifted.PopCount()) << n;
+		}
+	}
+}
+
 // ****************************************************************************
 // Testing arithmetic functions.
 // ****************************************************************************
@@ -700,6 +1151,1687 @@ TEST_F(StdLogicVectorTestBinaryOperators, AddRandomInputs) {
 		}
 }
 
+// Test StdLogicVector::Sub(), StdLogicVector::Negate() and
+// StdLogicVector::Compare() with some special inputs.
+TEST_F(StdLogicVectorTestBinaryOperators, SubSpecialInputs) {
+
+	StdLogicVector inp1, inp2;
+
+	// Test case 1: The borrow is truncated.
+	inp1 = StdLogicVector("00000000", 2, 8);
+	EXPECT_EQ(StdLogicVector("11111111", 2, 8), inp1.Sub(StdLogicVector(1, 8)));
+	EXPECT_EQ(8, inp1.getLength());
+
+	// Test case 2: Shorter operands are zero- or sign-extended.
+	inp1 = StdLogicVector("00010000", 2, 8);
+	inp2 = StdLogicVector("1111", 2, 4);
+	EXPECT_EQ(StdLogicVector("00000001", 2, 8), StdLogicVector(inp1).Sub(inp2));
+	EXPECT_EQ(StdLogicVector("00010001", 2, 8), StdLogicVector(inp1).Sub(inp2,
+			StdLogicVector::kSigned));
+
+	// Test case 3: Two's complement.
+	EXPECT_EQ(StdLogicVector("11111111", 2, 8), StdLogicVector(1, 8).Negate());
+	EXPECT_EQ(StdLogicVector(0, 8), StdLogicVector(0, 8).Negate());
+	EXPECT_EQ(StdLogicVector(1, 300).ShiftLeft(299),
+			StdLogicVector(1, 300).ShiftLeft(299).Negate());
+
+	// Test case 4: Unsigned and signed comparisons.
+	inp1 = StdLogicVector("00001000", 2, 8);
+	EXPECT_EQ(1, inp2.Compare(inp1, StdLogicVector::kUnsigned));
+	EXPECT_EQ(-1, inp2.Compare(inp1, StdLogicVector::kSigned));
+	EXPECT_EQ(0, inp2.Compare(StdLogicVector("11111111", 2, 8),
+			StdLogicVector::kSigned));
+	EXPECT_EQ(-1, inp2.Compare(StdLogicVector("11111111", 2, 8),
+			StdLogicVector::kUnsigned));
+	EXPECT_EQ(0, StdLogicVector().Compare(StdLogicVector(),
+			StdLogicVector::kSigned));
+
+	// Test case 5: Bits of the operand above its length are ignored.
+	inp1 = StdLogicVector("00010000", 2, 8);
+	inp2 = StdLogicVector("1111", 2, 4).ShiftLeft(2);
+	ASSERT_EQ(0x3CUL, mpz_get_ui(inp2.getValue()));
+	EXPECT_EQ(StdLogicVector("00000100", 2, 8), StdLogicVector(inp1).Sub(inp2));
+	EXPECT_EQ(StdLogicVector("00010100", 2, 8), StdLogicVector(inp1).Sub(inp2,
+			StdLogicVector::kSigned));
+	EXPECT_EQ(StdLogicVector("11000000", 2, 8), StdLogicVector(inp1).Mul(inp2,
+			true, StdLogicVector::kSigned));
+}
+
+// Converts a GMP integer into a StdLogicVector of the given length (modulo
+// 2^_length).
+static StdLogicVector FromMpz(const mpz_class & _value, int _length) {
+	mpz_class value;
+
+	mpz_fdiv_r_2exp(value.get_mpz_t(), _value.get_mpz_t(), _length);
+	return StdLogicVector(value.get_str(16), 16, _length);
+}
+
+// Interprets the value of a StdLogicVector as a two's complement number.
+static mpz_class SignedMpz(const StdLogicVector & _input) {
+	mpz_class value(_input.getValue());
+
+	if ( _input.getLength() > 0 && _input.TestBit(_input.getLength() - 1) ) {
+		value -= mpz_class(1) << _input.getLength();
+	}
+	return value;
+}
+
+// Test the arithmetic operations of StdLogicVectors of various widths against
+// the arithmetic of GMP integers.
+TEST(StdLogicVectorOperations, Arithmetic) {
+
+	int widths[][2] = {{8, 8}, {64, 64}, {100, 37}, {128, 128}, {256, 200},
+			{512, 512}, {520, 64}, {3000, 2999}};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		int n = widths[w][0];
+		int m = widths[w][1];
+
+		for (int i = 0; i < 20; ++i) {
+			string hex1, hex2;
+
+			for (int j = 0; j < (n + 3) / 4; ++j) {
+				hex1.push_back("0123456789ABCDEF"[rand() % 16]);
+			}
+			for (int j = 0; j < (m + 3) / 4; ++j) {
+				hex2.push_back("0123456789ABCDEF"[rand() % 16]);
+			}
+			// Use all-ones operands as well.
+			if ( i == 0 ) {
+				hex1 = string(hex1.size(), 'F');
+				hex2 = string(hex2.size(), 'F');
+			}
+
+			StdLogicVector a = StdLogicVector(hex1, 16, n).TruncateAfter(n);
+			StdLogicVector b = StdLogicVector(hex2, 16, m).TruncateAfter(m);
+			mpz_class ua(a.getValue()), ub(b.getValue());
+			mpz_class sa = SignedMpz(a), sb = SignedMpz(b);
+
+			EXPECT_EQ(FromMpz(ua - ub, n), StdLogicVector(a).Sub(b)) << n;
+			EXPECT_EQ(FromMpz(sa - sb, n), StdLogicVector(a).Sub(b,
+					StdLogicVector::kSigned)) << n;
+			EXPECT_EQ(FromMpz(-ua, n), StdLogicVector(a).Negate()) << n;
+			EXPECT_EQ(FromMpz(ua * ub, n), StdLogicVector(a).Mul(b)) << n;
+			EXPECT_EQ(FromMpz(sa * sb, n), StdLogicVector(a).Mul(b, true,
+					StdLogicVector::kSigned)) << n;
+			EXPECT_EQ(FromMpz(ua * ub, n + m), StdLogicVector(a).Mul(b, false,
+					StdLogicVector::kUnsigned)) << n;
+			EXPECT_EQ(FromMpz(sa * sb, n + m), StdLogicVector(a).Mul(b, false,
+					StdLogicVector::kSigned)) << n;
+			EXPECT_EQ(FromMpz(ua * ua, n), StdLogicVector(a).Square()) << n;
+			EXPECT_EQ(FromMpz(sa * sa, 2 * n), StdLogicVector(a).Square(false,
+					StdLogicVector::kSigned)) << n;
+			EXPECT_EQ(cmp(ua, ub) > 0, a.Compare(b, StdLogicVector::kUnsigned) > 0);
+			EXPECT_EQ(cmp(sa, sb) < 0, a.Compare(b, StdLogicVector::kSigned) < 0);
+		}
+	}
+}
+
+// Multiplies two GMP integers as polynomials over GF(2), bit by bit.
+static mpz_class ClMulMpz(const mpz_class & _a, const mpz_class & _b) {
+	mpz_class result = 0;
+
+	for (mp_bitcnt_t i = 0; i < mpz_sizeinbase(_b.get_mpz_t(), 2); ++i) {
+		if ( mpz_tstbit(_b.get_mpz_t(), i) ) {
+			result ^= _a << i;
+		}
+	}
+	return result;
+}
+
+// Reduces a GMP integer as a polynomial over GF(2) by long division.
+static mpz_class ReduceMpz(mpz_class _a, const mpz_class & _modulus) {
+	size_t m = mpz_sizeinbase(_modulus.get_mpz_t(), 2) - 1;
+
+	while ( _a != 0 && mpz_sizeinbase(_a.get_mpz_t(), 2) - 1 >= m ) {
+		_a ^= _modulus << (mpz_sizeinbase(_a.get_mpz_t(), 2) - 1 - m);
+	}
+	return _a;
+}
+
+// Test the carry-less multiplication and the binary field operations against
+// bit-serial references.
+TEST(StdLogicVectorOperations, CarryLess) {
+
+	// AES (FIPS-197, Section 4.2), GCM, NIST B-571 and a dense modulus (which
+	// is reduced bit by bit instead of by folding).
+	StdLogicVector aes("11B", 16, 9);
+	StdLogicVector gcm = StdLogicVector(1, 129).ShiftLeft(128).Xor(
+			StdLogicVector(0x87, 129));
+	StdLogicVector b571 = StdLogicVector(1, 572).ShiftLeft(571).Xor(
+			StdLogicVector(0x425, 572));
+	StdLogicVector dense("1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", 16, 157);
+	const StdLogicVector * moduli[] = { &aes, &gcm, &b571, &dense };
+
+	EXPECT_EQ(StdLogicVector(5, 4), StdLogicVector(3, 4).ClMul(
+			StdLogicVector(3, 4)));
+	EXPECT_EQ(StdLogicVector(0xFF, 8), StdLogicVector(0xF, 4).ClMul(
+			StdLogicVector(0x11, 5), false));
+	EXPECT_EQ(StdLogicVector(0xC1, 8), StdLogicVector(0x57, 8).GfMul(
+			StdLogicVector(0x83, 8), aes));
+	EXPECT_EQ(StdLogicVector(0xCA, 8), StdLogicVector(0x53, 8).GfInv(aes));
+	EXPECT_EQ(StdLogicVector(0, 8), StdLogicVector(0, 8).GfInv(aes));
+
+	for (unsigned int f = 0; f < sizeof(moduli)/sizeof(moduli[0]); ++f) {
+		int m = moduli[f]->getLength() - 1;
+		mpz_class modulus(moduli[f]->getValue());
+
+		for (int i = 0; i < 10; ++i) {
+			string hex1, hex2;
+
+			for (int j = 0; j < (m + 3) / 4; ++j) {
+				hex1.push_back("0123456789ABCDEF"[rand() % 16]);
+				hex2.push_back("0123456789ABCDEF"[rand() % 16]);
+			}
+			StdLogicVector a = StdLogicVector(hex1, 16, m).TruncateAfter(m);
+			StdLogicVector b = StdLogicVector(hex2, 16, m).TruncateAfter(m);
+			mpz_class ua(a.getValue()), ub(b.getValue());
+
+			EXPECT_EQ(FromMpz(ClMulMpz(ua, ub), m), StdLogicVector(a).ClMul(b));
+			EXPECT_EQ(FromMpz(ClMulMpz(ua, ub), 2 * m - 1),
+					StdLogicVector(a).ClMul(b, false)) << m;
+			EXPECT_EQ(FromMpz(ReduceMpz(ClMulMpz(ua, ub), modulus), m),
+					StdLogicVector(a).GfMul(b, *moduli[f])) << m;
+			EXPECT_EQ(FromMpz(ReduceMpz(ClMulMpz(ua, ua), modulus), m),
+					StdLogicVector(a).GfSquare(*moduli[f])) << m;
+
+			// The dense modulus is reducible, such that not every element has an
+			// inverse.
+			if ( moduli[f] != &dense ) {
+				EXPECT_EQ(StdLogicVector(1, m), StdLogicVector(a).GfInv(*moduli[f])
+						.GfMul(a, *moduli[f])) << m;
+			}
+		}
+	}
+}
+
+
+// ****************************************************************************
+// Storage Tests
+// ****************************************************************************
+// Test values crossing the threshold between inline and heap storage.
+TEST(StdLogicVectorStorage, InlineToHeap) {
+
+	StdLogicVector dut, expOutp;
+	string ones(64, 'F');
+
+	// Test case 1: Carry out of a 256-bit value.
+	dut			= StdLogicVector(ones, 16, 256);
+	expOutp	= StdLogicVector("1" + string(64, '0'), 16, 257);
+	dut.Add(StdLogicVector(1, 256), false);
+	EXPECT_EQ(expOutp, dut);
+
+	// Test case 2: Shifting beyond the inline limbs and back again.
+	dut			= StdLogicVector(ones, 16, 256);
+	expOutp	= dut;
+	dut.ShiftLeft(300).ShiftRight(300);
+	EXPECT_EQ(expOutp, dut);
+
+	// Test case 3: Truncated add of two 256-bit values.
+	dut			= StdLogicVector(ones, 16, 256);
+	expOutp	= StdLogicVector(string(63, 'F') + "E", 16, 256);
+	dut.Add(StdLogicVector(ones, 16, 256));
+	EXPECT_EQ(expOutp, dut);
+}
+
+// Test copying between inline and heap storage.
+TEST(StdLogicVectorStorage, CopyAssignment) {
+
+	StdLogicVector small, large, dut;
+
+	small = StdLogicVector("A5", 16, 8);
+	large = StdLogicVector("1" + string(100, '0'), 16, 401);
+
+	// Test case 1: Heap value into inline storage and back.
+	dut = small;
+	dut = large;
+	EXPECT_EQ(large, dut);
+	dut = small;
+	EXPECT_EQ(small, dut);
+
+	// Test case 2: Copies are independent of each other.
+	dut = large;
+	dut.Xor(large);
+	EXPECT_EQ(0, dut.ToULL());
+	EXPECT_EQ(401, static_cast<int>(mpz_sizeinbase(large.getValue(), 2)));
+
+	// Test case 3: Self-assignment.
+	dut = large;
+	dut = *&dut;
+	EXPECT_EQ(large, dut);
+}
+
+
+// Test moving StdLogicVectors with inline and heap storage.
+TEST(StdLogicVectorStorage, Move) {
+
+	StdLogicVector small, large, expSmall, expLarge, dut;
+
+	expSmall	= StdLogicVector("A5", 16, 8);
+	expLarge	= StdLogicVector("1" + string(100, '0'), 16, 401);
+
+	// Test case 1: Move-construction
+	small = expSmall;
+	large = expLarge;
+	StdLogicVector dut1(std::move(small));
+	StdLogicVector dut2(std::move(large));
+	EXPECT_EQ(expSmall, dut1);
+	EXPECT_EQ(expLarge, dut2);
+
+	// Test case 2: Move-assignment into inline and heap storage
+	dut = StdLogicVector(expLarge);
+	EXPECT_EQ(expLarge, dut);
+	dut = StdLogicVector(expLarge).ShiftLeft(1);
+	EXPECT_EQ(StdLogicVector(expLarge).ShiftLeft(1), dut);
+	dut = StdLogicVector(expSmall);
+	EXPECT_EQ(expSmall, dut);
+
+	// Test case 3: Moved-from StdLogicVectors can be reassigned.
+	large = expLarge;
+	dut   = std::move(large);
+	large = expSmall;
+	EXPECT_EQ(expSmall, large);
+	EXPECT_EQ(expLarge, dut);
+}
+
+// ****************************************************************************
+// View Tests
+// ****************************************************************************
+// Test reading bits through a StdLogicVectorView.
+TEST(StdLogicVectorViews, Read) {
+
+	StdLogicVector dut;
+
+	dut = StdLogicVector("ABCDEF0123456789" "FEDCBA9876543210", 16, 128);
+	StdLogicVectorView view = dut.Slice(75, 56);
+
+	EXPECT_EQ(20, view.getLength());
+	EXPECT_EQ(0x789FEULL, view.ToULL());
+	EXPECT_EQ("789fe", view.ToString(16));
+	EXPECT_EQ(1, view.TestBit(1));
+	EXPECT_EQ(0, view.TestBit(0));
+	EXPECT_EQ(StdLogicVector("789FE", 16, 20), view);
+	EXPECT_NE(StdLogicVector("789FE", 16, 24), view);
+	EXPECT_EQ(dut.Slice(107, 104), dut.Slice(63, 60));
+	EXPECT_NE(dut.Slice(11, 8), dut.Slice(7, 4));
+
+	// Views are clipped at the length of their parent.
+	EXPECT_EQ(8, dut.Slice(200, 120).getLength());
+}
+
+// Test writing bits through a StdLogicVectorView.
+TEST(StdLogicVectorViews, Write) {
+
+	StdLogicVector dut, src;
+
+	// Test case 1: Writing a StdLogicVector (shorter than the view)
+	dut = StdLogicVector(string(100, 'F'), 16, 400);
+	dut.Slice(139, 60) = StdLogicVector(0xAB, 8);
+	EXPECT_EQ(StdLogicVector(string(65, 'F') + string(18, '0') + "AB" +
+			string(15, 'F'), 16, 400), dut);
+
+	// Test case 2: Writing an unsigned long long
+	dut = StdLogicVector(0, 16);
+	dut.Slice(11, 4) = 0x1FFULL;
+	EXPECT_EQ(StdLogicVector("0FF0", 16, 16), dut);
+
+	// Test case 3: Copying between views of different and the same parents
+	src = StdLogicVector("C3", 16, 8);
+	dut = StdLogicVector(0, 16);
+	dut.Slice(15, 8) = src.Slice(7, 0);
+	EXPECT_EQ(StdLogicVector("C300", 16, 16), dut);
+	dut.Slice(11, 4) = dut.Slice(15, 8);
+	EXPECT_EQ(StdLogicVector("CC30", 16, 16), dut);
+}
+
+// Test views as operands of StdLogicVector operations.
+TEST(StdLogicVectorViews, Operands) {
+
+	StdLogicVector state, dut;
+
+	state = StdLogicVector("0123456789ABCDEF" "FEDCBA9876543210", 16, 128);
+
+	dut = StdLogicVector("FF", 16, 8);
+	EXPECT_EQ(StdLogicVector("EF", 16, 8), dut.And(state.Slice(71, 64)));
+	EXPECT_EQ(StdLogicVector("FF", 16, 8), dut.Or(state.Slice(7, 0)));
+	EXPECT_EQ(StdLogicVector("FE", 16, 8), dut.Xor(state.Slice(7, 4)));
+
+	dut = StdLogicVector("F0", 16, 8);
+	EXPECT_EQ(StdLogicVector("DF", 16, 8), dut.Add(state.Slice(71, 64)));
+	dut = StdLogicVector("F0", 16, 8);
+	EXPECT_EQ(StdLogicVector("1DF", 16, 9), dut.Add(state.Slice(71, 64), false));
+
+	// Views onto the StdLogicVector itself
+	dut = StdLogicVector("1234", 16, 16);
+	EXPECT_EQ(StdLogicVector("1246", 16, 16), dut.Add(dut.Slice(15, 8)));
+}
+
+// Test reading bits through a StdLogicVectorConstView.
+TEST(StdLogicVectorViews, ConstView) {
+
+	StdLogicVector state, dut;
+	StdLogicVectorArray array(2, 16);
+
+	state = StdLogicVector("0123456789ABCDEF" "FEDCBA9876543210", 16, 128);
+	const StdLogicVector & constState = state;
+
+	// Test case 1: Reading a const StdLogicVector.
+	StdLogicVectorConstView view = constState.Slice(75, 56);
+	EXPECT_EQ(20, view.getLength());
+	EXPECT_EQ(0, view.TestBit(0));
+	EXPECT_EQ(1, view.TestBit(1));
+	EXPECT_EQ(0xDEFFEULL, view.ToULL());
+	EXPECT_EQ("deffe", view.ToString(16));
+	EXPECT_EQ(StdLogicVector("DEFFE", 16, 20), view);
+	EXPECT_EQ(state.Slice(75, 56), view);
+	EXPECT_EQ(&state, view.getParent());
+
+	// Test case 2: Read-only views as operands.
+	dut = StdLogicVector("FF", 16, 8);
+	EXPECT_EQ(StdLogicVector("EF", 16, 8), dut.And(constState.Slice(71, 64)));
+	dut = StdLogicVector("F0", 16, 8);
+	EXPECT_EQ(StdLogicVector("DF", 16, 8), dut.Add(constState.Slice(71, 64)));
+	EXPECT_EQ(StdLogicVector("30", 16, 8),
+			StdLogicVector(dut ^ constState.Slice(71, 64)));
+
+	// Test case 3: Views onto array elements have no parent.
+	array[1] = 0x1234;
+	EXPECT_TRUE(array[1].getParent() == NULL);
+	EXPECT_EQ(StdLogicVector(0x1234, 16), array.getElement(1));
+}
+
+
+// ****************************************************************************
+// Array Tests
+// ****************************************************************************
+// Test accessing the elements of a StdLogicVectorArray.
+TEST(StdLogicVectorArrays, Elements) {
+
+	StdLogicVectorArray dut(5, 100);
+	StdLogicVectorArray copy;
+
+	// Test case 1: Writing and reading elements.
+	for (int i = 0; i < 5; ++i) {
+		dut[i] = StdLogicVector(0x1000000000000001ull * (i + 1), 64).ShiftLeft(i);
+	}
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(dut.getLimbs()) % 64);
+	EXPECT_EQ(StdLogicVector(0x3000000000000003ull, 100).ShiftLeft(2),
+			dut.getElement(2));
+	EXPECT_EQ(StdLogicVector(0x2000000000000002ull, 100).ShiftLeft(1),
+			dut[1]);
+
+	// Test case 2: Elements are clipped to the length of the array.
+	dut[4] = StdLogicVector("FFFFFFFFFFFFFFFFFFFFFFFFFFFF", 16, 112);
+	EXPECT_EQ(StdLogicVector("FFFFFFFFFFFFFFFFFFFFFFFFF", 16, 100),
+			dut.getElement(4));
+
+	// Test case 3: Copies are deep.
+	copy = dut;
+	copy[0] = 0;
+	EXPECT_EQ(StdLogicVector(0, 100), copy.getElement(0));
+	EXPECT_EQ(StdLogicVector(0x1000000000000001ull, 100), dut.getElement(0));
+
+	// Test case 4: Failing allocations throw.
+	EXPECT_THROW(StdLogicVectorArray(SIZE_MAX / 2, 64), bad_alloc);
+
+	// Test case 5: Sizes which overflow a size_t throw instead of wrapping.
+	EXPECT_THROW(StdLogicVectorArray(SIZE_MAX / 2 + 1, 128), bad_alloc);
+	EXPECT_THROW(StdLogicVectorArray(SIZE_MAX / 3 + 1, 192), bad_alloc);
+}
+
+// Test the operations of StdLogicVectorArrays against those of StdLogicVectors.
+TEST(StdLogicVectorArrays, MatchStdLogicVector) {
+
+	int widths[] = {1, 37, 64, 100, 128, 300};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		int width = widths[w];
+		StdLogicVectorArray a(7, width), b(7, width);
+		StdLogicVector exp[7];
+
+		for (int i = 0; i < 7; ++i) {
+			a[i] = StdLogicVector(0x9E3779B97F4A7C15ull * (i + 3), 64).ShiftLeft(
+					i * 29).Xor(StdLogicVector(0xC2B2AE3D27D4EB4Full * i, 64));
+			b[i] = StdLogicVector(0x165667B19E3779F9ull * (i + 1), 64).ShiftLeft(
+					i * 41).Or(StdLogicVector(i, 64));
+			exp[i] = a.getElement(i);
+			exp[i].setWrapping(true);
+			exp[i].Xor(b.getElement(i)).Add(b.getElement(i)).ShiftLeft(
+					width / 3).And(b.getElement(i)).ShiftRight(5).Or(b.getElement(i));
+			exp[i].TruncateAfter(width - width / 4);
+		}
+		a.Xor(b).Add(b).ShiftLeft(width / 3).And(b).ShiftRight(5).Or(b);
+		a.TruncateAfter(width - width / 4);
+
+		for (int i = 0; i < 7; ++i) {
+			EXPECT_EQ(exp[i], a.getElement(i)) << "width " << width;
+		}
+	}
+}
+
+// Test the bit counting of StdLogicVectorArrays against that of
+// StdLogicVectors.
+TEST(StdLogicVectorArrays, BitCounting) {
+
+	int widths[] = {1, 64, 100, 300};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		StdLogicVectorArray a(21, widths[w]), b(21, widths[w]);
+		mp_bitcnt_t total = 0;
+
+		for (int i = 0; i < 21; ++i) {
+			a[i] = StdLogicVector(0x9E3779B97F4A7C15ull * (i + 3), 64).ShiftLeft(i);
+			b[i] = StdLogicVector(0x165667B19E3779F9ull * (i + 1), 64).ShiftLeft(
+					i * 11);
+		}
+		vector<int> counts = a.PopCounts();
+		vector<int> distances = a.HammingDistances(b);
+
+		ASSERT_EQ(21u, counts.size());
+		ASSERT_EQ(21u, distances.size());
+		for (int i = 0; i < 21; ++i) {
+			EXPECT_EQ(a.getElement(i).PopCount(), counts[i]) << widths[w];
+			EXPECT_EQ(a.getElement(i).HammingDistance(b.getElement(i)),
+					distances[i]) << widths[w];
+			total += distances[i];
+		}
+		EXPECT_EQ(total, a.HammingDistance(b));
+		EXPECT_TRUE(a.HammingDistances(StdLogicVectorArray(20, widths[w])).empty());
+	}
+}
+
+
+// ****************************************************************************
+// Kernel Tests
+// ****************************************************************************
+// Test every bitwise kernel supported by the host against GMP.
+TEST(StdLogicVectorKernels, Bitwise) {
+
+	const BitwiseKernels * kernels[8];
+	int count = AvailableBitwiseKernels(kernels, 8);
+	mp_limb_t a[40], b[40], act[41];
+	mpz_t opA, opB, exp, res;
+
+	mpz_inits(opA, opB, exp, NULL);
+	for (int i = 0; i < 40; ++i) {
+		a[i] = 0x9E3779B97F4A7C15ull * (i + 1);
+		b[i] = 0xC2B2AE3D27D4EB4Full * (i + 7);
+	}
+	EXPECT_STREQ("portable", kernels[count - 1]->name);
+
+	for (int k = 0; k < count; ++k) {
+		for (mp_size_t n = 1; n <= 40; ++n) {
+			mpz_roinit_n(opA, a, n);
+			mpz_roinit_n(opB, b, n);
+			act[n] = 0x5A5A;
+
+			kernels[k]->And(act, a, b, n);
+			mpz_and(exp, opA, opB);
+			EXPECT_EQ(0, mpz_cmp(exp, mpz_roinit_n(res, act, n)));
+			kernels[k]->Or(act, a, b, n);
+			mpz_ior(exp, opA, opB);
+			EXPECT_EQ(0, mpz_cmp(exp, mpz_roinit_n(res, act, n)));
+			// The destination may be one of the sources.
+			kernels[k]->Xor(act, act, b, n);
+			mpz_xor(exp, exp, opB);
+			EXPECT_EQ(0, mpz_cmp(exp, mpz_roinit_n(res, act, n)))
+					<< kernels[k]->name << ", " << n << " limbs";
+			EXPECT_EQ(0x5A5Au, act[n]);
+
+			// Mismatches in limbs whose care mask is zero are ignored.
+			EXPECT_EQ(n, kernels[k]->FindMismatch(a, a, b, n));
+			act[n - 1] = a[n - 1] ^ 0x100;
+			for (mp_size_t i = 0; i < n - 1; ++i) {
+				act[i] = a[i] ^ ((i % 3 == 0) ? 0 : ~b[i]);
+			}
+			EXPECT_EQ((n - 1) ^ ((b[n - 1] & 0x100) ? 0 : (n - 1) ^ n),
+					kernels[k]->FindMismatch(a, act, b, n))
+					<< kernels[k]->name << ", " << n << " limbs";
+		}
+	}
+	mpz_clears(opA, opB, exp, NULL);
+}
+
+
+// Test every carry-less multiplication kernel supported by the host as well as
+// the Karatsuba multiplication against a bit-serial reference.
+TEST(StdLogicVectorKernels, ClMul) {
+
+	const ClMulKernels * kernels[8];
+	int count = AvailableClMulKernels(kernels, 8);
+	mp_limb_t a[100], b[100], act[201];
+	mpz_t opA, opB, res;
+	mp_size_t sizes[][2] = {{16, 16}, {17, 17}, {40, 40}, {100, 100},
+			{100, 17}, {23, 61}};
+
+	for (int i = 0; i < 100; ++i) {
+		a[i] = 0x9E3779B97F4A7C15ull * (i + 1);
+		b[i] = 0xC2B2AE3D27D4EB4Full * (i + 7);
+	}
+	a[0] = b[1] = ~0ull;
+	EXPECT_STREQ("portable", kernels[count - 1]->name);
+
+	for (int k = 0; k < count; ++k) {
+		for (mp_size_t an = 1; an <= 12; ++an) {
+			for (mp_size_t bn = 1; bn <= 3; ++bn) {
+				mpz_class exp = ClMulMpz(mpz_class(mpz_roinit_n(opA, a, an)),
+						mpz_class(mpz_roinit_n(opB, b, bn)));
+
+				act[an + bn] = 0x5A5A;
+				kernels[k]->Mul(act, a, an, b, bn);
+				EXPECT_EQ(0, mpz_cmp(exp.get_mpz_t(),
+						mpz_roinit_n(res, act, an + bn)))
+						<< kernels[k]->name << ", " << an << "x" << bn << " limbs";
+				EXPECT_EQ(0x5A5Au, act[an + bn]);
+			}
+		}
+	}
+
+	for (unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]); ++s) {
+		mp_size_t an = sizes[s][0], bn = sizes[s][1];
+		mpz_class exp = ClMulMpz(mpz_class(mpz_roinit_n(opA, a, an)),
+				mpz_class(mpz_roinit_n(opB, b, bn)));
+
+		ClMulLimbs(act, a, an, b, bn);
+		EXPECT_EQ(0, mpz_cmp(exp.get_mpz_t(), mpz_roinit_n(res, act, an + bn)))
+				<< an << "x" << bn << " limbs";
+	}
+	ClSquareLimbs(act, a, 100);
+	EXPECT_EQ(0, mpz_cmp(ClMulMpz(mpz_class(mpz_roinit_n(opA, a, 100)),
+			mpz_class(mpz_roinit_n(opB, a, 100))).get_mpz_t(),
+			mpz_roinit_n(res, act, 200)));
+}
+
+// Test every population count kernel supported by the host against GMP.
+TEST(StdLogicVectorKernels, PopCount) {
+
+	const PopCountKernels * kernels[8];
+	int count = AvailablePopCountKernels(kernels, 8);
+	mp_limb_t a[40], b[40];
+	mpz_t opA, opB;
+	int act[40];
+
+	for (int i = 0; i < 40; ++i) {
+		a[i] = 0x9E3779B97F4A7C15ull * (i + 1);
+		b[i] = 0xC2B2AE3D27D4EB4Full * (i + 7);
+	}
+	a[3] = ~0ull;
+	EXPECT_STREQ("portable", kernels[count - 1]->name);
+
+	for (int k = 0; k < count; ++k) {
+		for (mp_size_t n = 1; n <= 40; ++n) {
+			mpz_roinit_n(opA, a, n);
+			mpz_roinit_n(opB, b, n);
+			EXPECT_EQ(mpz_popcount(opA), kernels[k]->PopCount(a, NULL, n))
+					<< kernels[k]->name << ", " << n << " limbs";
+			EXPECT_EQ(mpz_hamdist(opA, opB), kernels[k]->PopCount(a, b, n))
+					<< kernels[k]->name << ", " << n << " limbs";
+		}
+
+		// Elements of one and of three limbs.
+		for (mp_size_t stride = 1; stride <= 3; stride += 2) {
+			size_t elements = 39 / stride;
+
+			act[elements] = 0x5A5A;
+			kernels[k]->PopCounts(act, a, b, elements, stride);
+			for (size_t i = 0; i < elements; ++i) {
+				mpz_roinit_n(opA, a + i * stride, stride);
+				mpz_roinit_n(opB, b + i * stride, stride);
+				EXPECT_EQ(static_cast<int>(mpz_hamdist(opA, opB)), act[i])
+						<< kernels[k]->name << ", element " << i;
+			}
+			EXPECT_EQ(0x5A5A, act[elements]);
+		}
+	}
+}
+
+// Test every shuffle kernel supported by the host against a bit-serial
+// reference.
+TEST(StdLogicVectorKernels, Shuffle) {
+
+	const ShuffleKernels * kernels[8];
+	int count = AvailableShuffleKernels(kernels, 8);
+	mp_limb_t a[40], act[41];
+	char digits[40 * 16 + 2], ref[40 * 64 + 2];
+	mpz_t op;
+
+	for (int i = 0; i < 40; ++i) {
+		a[i] = 0x9E3779B97F4A7C15ull * (i + 1);
+	}
+	a[2] = 1;
+	EXPECT_STREQ("portable", kernels[count - 1]->name);
+
+	for (int k = 0; k < count; ++k) {
+		for (mp_size_t n = 1; n <= 40; ++n) {
+			mp_bitcnt_t bits = n * GMP_NUMB_BITS;
+
+			copy(a, a + n, act);
+			act[n] = 0x5A5A;
+			kernels[k]->Reverse(act, n);
+			for (mp_bitcnt_t i = 0; i < bits; ++i) {
+				if ( ((a[i / 64] >> (i % 64)) & 1) !=
+						((act[(bits - 1 - i) / 64] >> ((bits - 1 - i) % 64)) & 1) ) {
+					ADD_FAILURE() << kernels[k]->name << ", " << n << " limbs, bit " << i;
+					break;
+				}
+			}
+			EXPECT_EQ(0x5A5Au, act[n]);
+
+			// Leading zeros are written as well.
+			string exp(mpz_get_str(ref, -16, mpz_roinit_n(op, a, n)));
+			exp.insert(0, n * 16 - exp.size(), '0');
+			digits[n * 16] = '#';
+			kernels[k]->FormatHex(digits, a, n, "0123456789ABCDEF");
+			EXPECT_EQ(exp, string(digits, n * 16))
+					<< kernels[k]->name << ", " << n << " limbs";
+			EXPECT_EQ('#', digits[n * 16]);
+
+			// Digits are case-insensitive, and parsing stops at the first limb
+			// containing a non-digit.
+			transform(exp.begin(), exp.end(), exp.begin(), ::tolower);
+			act[n] = 0x5A5A;
+			EXPECT_EQ(n, kernels[k]->ParseHex(act, exp.data() + n * 16, n));
+			EXPECT_TRUE(equal(a, a + n, act))
+					<< kernels[k]->name << ", " << n << " limbs";
+			EXPECT_EQ(0x5A5Au, act[n]);
+			exp[(n - 1 - (n - 1) / 2) * 16 + 3] = 'g';
+			EXPECT_EQ((n - 1) / 2,
+					kernels[k]->ParseHex(act, exp.data() + n * 16, n));
+
+			string bin(mpz_get_str(ref, 2, mpz_roinit_n(op, a, n)));
+			bin.insert(0, n * 64 - bin.size(), '0');
+			EXPECT_EQ(n, kernels[k]->ParseBinary(act, bin.data() + n * 64, n));
+			EXPECT_TRUE(equal(a, a + n, act))
+					<< kernels[k]->name << ", " << n << " limbs";
+			bin[(n - 1 - (n - 1) / 2) * 64 + 37] = '2';
+			EXPECT_EQ((n - 1) / 2,
+					kernels[k]->ParseBinary(act, bin.data() + n * 64, n));
+		}
+	}
+}
+
+// Test the nine-valued logic kernels of all kernel sets against the portable
+// ones (the latter being tested by the StdULogicVector tests).
+TEST(StdLogicVectorKernels, ULogic) {
+
+	const ULogicKernels * kernels[8];
+	int count = AvailableULogicKernels(kernels, 8);
+	const int codes[9] = {0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0xA, 0xE};
+	const mp_size_t stride = 3 * kULogicBlockLimbs;
+	alignas(64) mp_limb_t a[4 * stride], b[4 * stride];
+	alignas(64) mp_limb_t exp[4 * stride], act[4 * stride];
+	unsigned int seed = 0x9E3779B9u;
+
+	// Each bit of both operands is one of the nine valid codes.
+	for (mp_size_t i = 0; i < 4 * stride; ++i) {
+		a[i] = b[i] = 0;
+	}
+	for (int bit = 0; bit < stride * GMP_NUMB_BITS; ++bit) {
+		for (int k = 0; k < 2; ++k) {
+			mp_limb_t * planes = k ? b : a;
+			int code;
+
+			seed = seed * 1103515245u + 12345u;
+			code = codes[(seed >> 16) % 9];
+			for (int plane = 0; plane < 4; ++plane) {
+				planes[plane * stride + bit / GMP_NUMB_BITS] |=
+						static_cast<mp_limb_t>((code >> plane) & 1) << (bit % GMP_NUMB_BITS);
+			}
+		}
+	}
+	EXPECT_STREQ("portable", kernels[count - 1]->name);
+
+	for (int k = 0; k < count; ++k) {
+		void (*binary[4])(mp_limb_t *, const mp_limb_t *, mp_size_t) = {
+			kernels[k]->And, kernels[k]->Or, kernels[k]->Xor, kernels[k]->Resolve
+		};
+		void (*reference[4])(mp_limb_t *, const mp_limb_t *, mp_size_t) = {
+			kernels[count - 1]->And, kernels[count - 1]->Or, kernels[count - 1]->Xor,
+			kernels[count - 1]->Resolve
+		};
+
+		for (int op = 0; op < 4; ++op) {
+			copy(a, a + 4 * stride, exp);
+			copy(a, a + 4 * stride, act);
+			reference[op](exp, b, stride);
+			binary[op](act, b, stride);
+			EXPECT_TRUE(equal(exp, exp + 4 * stride, act))
+					<< kernels[k]->name << ", operation " << op;
+		}
+		copy(a, a + 4 * stride, exp);
+		copy(a, a + 4 * stride, act);
+		kernels[count - 1]->Not(exp, stride);
+		kernels[k]->Not(act, stride);
+		EXPECT_TRUE(equal(exp, exp + 4 * stride, act)) << kernels[k]->name;
+	}
+}
+
+
+// ****************************************************************************
+// Modular Arithmetic Tests
+// ****************************************************************************
+// Test the modular operations against the arithmetic of GMP integers.
+TEST(StdLogicVectorModContexts, MatchMpz) {
+
+	const char * moduli[] = {
+		"1FFFFFFFFFFFFFFF",
+		"7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED",
+		"C90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A0879"
+		"8E3404DDEF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6"
+		"F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE649286651"
+		"ECE65381FFFFFFFFFFFFFFFF",
+		"10000000000000000000000000000000000000000000000000000000000000000",
+		"FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE"};
+
+	for (unsigned int m = 0; m < sizeof(moduli)/sizeof(moduli[0]); ++m) {
+		string hex(moduli[m]);
+		int length = hex.size() * 4;
+		StdLogicVectorModContext ctx(StdLogicVector(hex, 16, length));
+		mpz_class n(hex, 16);
+		mpz_class r = mpz_class(1) << (mpz_size(n.get_mpz_t()) * GMP_NUMB_BITS);
+		mpz_class rInv;
+
+		if ( ctx.isOdd() ) {
+			EXPECT_EQ(FromMpz(r % n, length), ctx.getR());
+			EXPECT_EQ(FromMpz(r * r % n, length), ctx.getR2());
+			EXPECT_EQ(0u, (ctx.getNPrime() * mpz_getlimbn(n.get_mpz_t(), 0)) + 1);
+			mpz_invert(rInv.get_mpz_t(), r.get_mpz_t(), n.get_mpz_t());
+		}
+
+		for (int i = 0; i < 10; ++i) {
+			string hexA, hexB, hexBig;
+
+			for (unsigned int j = 0; j < hex.size(); ++j) {
+				hexA.push_back("0123456789ABCDEF"[rand() % 16]);
+				hexB.push_back("0123456789ABCDEF"[rand() % 16]);
+			}
+			for (unsigned int j = 0; j < 3 * hex.size(); ++j) {
+				hexBig.push_back("0123456789ABCDEF"[rand() % 16]);
+			}
+			mpz_class a(hexA, 16), b(hexB, 16), big(hexBig, 16), e, inv;
+			StdLogicVector va(hexA, 16, length), vb(hexB, 16, length);
+			StdLogicVector result;
+
+			e = b >> (i * 37 % length);
+			EXPECT_EQ(FromMpz(a % n, length), ctx.Reduce(va));
+			EXPECT_EQ(FromMpz(big % n, length), ctx.Reduce(StdLogicVector(hexBig,
+					16, hexBig.size() * 4)));
+			EXPECT_EQ(FromMpz((a + b) % n, length), ctx.ModAdd(va, vb));
+			EXPECT_EQ(FromMpz((a % n - b % n + n) % n, length), ctx.ModSub(va, vb));
+			EXPECT_EQ(FromMpz(a * b % n, length), ctx.ModMul(va, vb));
+			mpz_powm(inv.get_mpz_t(), a.get_mpz_t(), e.get_mpz_t(), n.get_mpz_t());
+			EXPECT_EQ(FromMpz(inv, length), ctx.ModExp(va, FromMpz(e, length)));
+			// The results may also be written to one of the operands.
+			result = va;
+			ctx.ModExp(result, FromMpz(e, length), result);
+			EXPECT_EQ(FromMpz(inv, length), result);
+			result = vb;
+			ctx.ModMul(va, result, result);
+			EXPECT_EQ(FromMpz(a * b % n, length), result);
+			ctx.ModMul(result, result, result);
+			EXPECT_EQ(FromMpz((a * b % n) * (a * b % n) % n, length), result);
+			EXPECT_EQ(mpz_invert(inv.get_mpz_t(), a.get_mpz_t(), n.get_mpz_t()) != 0,
+					ctx.ModInv(va, result));
+			if ( mpz_invert(inv.get_mpz_t(), a.get_mpz_t(), n.get_mpz_t()) ) {
+				EXPECT_EQ(FromMpz(inv, length), result);
+			}
+			if ( !ctx.isOdd() ) {
+				continue;
+			}
+			EXPECT_EQ(FromMpz(a * r % n, length), ctx.ToMontgomery(va));
+			EXPECT_EQ(FromMpz(a % n, length), ctx.FromMontgomery(
+					ctx.ToMontgomery(va)));
+			EXPECT_EQ(FromMpz(a * b * rInv % n, length), ctx.MontMul(va, vb));
+			result = va;
+			ctx.MontMul(result, vb, result);
+			EXPECT_EQ(FromMpz(a * b * rInv % n, length), result);
+		}
+		EXPECT_EQ(FromMpz(1 % n, length), ctx.ModExp(StdLogicVector(7, 8),
+				StdLogicVector()));
+		// The largest product requires the most corrections of the quotient.
+		EXPECT_EQ(FromMpz((n - 1) * (n - 1) % n, length), ctx.ModMul(
+				FromMpz(n - 1, length), FromMpz(n - 1, length)));
+	}
+
+	// Moduli beyond the unrolled kernels and beyond the truncated products
+	// computed by GMP.
+	int widths[] = {520, 1100, 4096};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		string hexN, hexA, hexB;
+
+		for (int j = 0; j < widths[w] / 4; ++j) {
+			hexN.push_back("0123456789ABCDEF"[rand() % 16]);
+			hexA.push_back("0123456789ABCDEF"[rand() % 16]);
+			hexB.push_back("0123456789ABCDEF"[rand() % 16]);
+		}
+		hexN[0] = 'F';
+		hexN[hexN.size() - 1] = 'B';
+		mpz_class n(hexN, 16), a(hexA, 16), b(hexB, 16);
+		StdLogicVectorModContext ctx(StdLogicVector(hexN, 16, widths[w]));
+		StdLogicVector result = StdLogicVector(hexA, 16, widths[w]);
+
+		ctx.ModMul(result, StdLogicVector(hexB, 16, widths[w]), result);
+		EXPECT_EQ(FromMpz(a * b % n, widths[w]), result) << widths[w];
+		EXPECT_EQ(FromMpz((n - 1) * (n - 1) % n, widths[w]), ctx.ModMul(
+				FromMpz(n - 1, widths[w]), FromMpz(n - 1, widths[w]))) << widths[w];
+	}
+}
+
+// Test the bit-true radix-2^k Montgomery multiplication.
+TEST(StdLogicVectorModContexts, MontMulRadix) {
+
+	StdLogicVectorModContext ctx(StdLogicVector(
+			"7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED", 16,
+			255));
+	StdLogicVector a("123456789ABCDEF0FEDCBA9876543210F0E1D2C3B4A59687", 16, 255);
+	StdLogicVector b("6A09E667F3BCC908BB67AE8584CAA73B3C6EF372FE94F82BA54FF53A",
+			16, 255);
+	int radices[] = {1, 2, 4, 8, 16, 32, 64};
+
+	for (unsigned int k = 0; k < sizeof(radices)/sizeof(radices[0]); ++k) {
+		vector<StdLogicVector> trace;
+
+		EXPECT_EQ(ctx.MontMul(a, b), ctx.MontMulRadix(a, b, radices[k], &trace));
+		EXPECT_EQ(256u / radices[k], trace.size());
+		// The intermediate values stay below 2n.
+		for (unsigned int i = 0; i < trace.size(); ++i) {
+			EXPECT_EQ(256, trace[i].getLength());
+			EXPECT_EQ(-1, trace[i].Compare(StdLogicVector(ctx.getModulus()).
+					ShiftLeft(1).TruncateAfter(256), StdLogicVector::kUnsigned));
+		}
+	}
+
+	// Radix-2 steps by hand: T = (T + a_i * b + q * n) / 2 for a = 1.
+	StdLogicVectorModContext small(StdLogicVector(13, 4));
+	vector<StdLogicVector> trace;
+	EXPECT_EQ(StdLogicVector(), small.MontMulRadix(a, b, 3, NULL));
+	small.MontMulRadix(StdLogicVector(1, 4), StdLogicVector(5, 4), 1, &trace);
+	EXPECT_EQ(StdLogicVector(9, 5), trace[0]);
+	EXPECT_EQ(StdLogicVector(11, 5), trace[1]);
+	EXPECT_EQ(StdLogicVector(12, 5), trace[2]);
+
+	// Radices not dividing 64 with R = 2^(k * ceil(255 / k)), against the
+	// steps computed with GMP integers.
+	mpz_class n(ctx.getModulus().getValue()), ma(a.getValue()),
+			mb(b.getValue());
+	int odd[] = {3, 5, 7, 17, 51, 64};
+
+	for (unsigned int k = 0; k < sizeof(odd)/sizeof(odd[0]); ++k) {
+		int iterations = (255 + odd[k] - 1) / odd[k];
+		mpz_class mask = (mpz_class(1) << odd[k]) - 1;
+		mpz_class r = mpz_class(1) << (odd[k] * iterations);
+		mpz_class nPrime, rInv, t = 0;
+
+		trace.clear();
+		mpz_invert(nPrime.get_mpz_t(), n.get_mpz_t(), r.get_mpz_t());
+		nPrime = r - nPrime;
+		mpz_invert(rInv.get_mpz_t(), r.get_mpz_t(), n.get_mpz_t());
+		EXPECT_EQ(FromMpz(ma * mb * rInv % n, 255), ctx.MontMulRadix(a, b,
+				odd[k], iterations, &trace)) << odd[k];
+		ASSERT_EQ(static_cast<unsigned int>(iterations), trace.size());
+		for (int i = 0; i < iterations; ++i) {
+			t += ((ma >> (odd[k] * i)) & mask) * mb;
+			t = (t + ((t * nPrime) & mask) * n) >> odd[k];
+			EXPECT_EQ(FromMpz(t, 256), trace[i]) << odd[k] << " " << i;
+		}
+		EXPECT_EQ(StdLogicVector(), ctx.MontMulRadix(a, b, odd[k],
+				iterations - 1, NULL));
+	}
+}
+
+
+// ****************************************************************************
+// Pattern Tests
+// ****************************************************************************
+// Test matching values against patterns with don't-care bits.
+TEST(StdLogicVectorPatterns, Matches) {
+
+	StdLogicVectorPattern dut("1--0", 2, 4);
+	StdLogicVectorPattern hex("DEAD-EEF", 16, 32);
+	StdLogicVector wide = StdLogicVector(1, 300).ShiftLeft(299).Or(
+			StdLogicVector(0x0123456789ABCDEFull, 300));
+
+	// Test case 1: Binary patterns.
+	EXPECT_EQ("1--0", dut.ToString());
+	EXPECT_TRUE(dut.Matches(StdLogicVector("1010", 2, 4)));
+	EXPECT_TRUE(dut.Matches(StdLogicVector("1100", 2, 4)));
+	EXPECT_FALSE(dut.Matches(StdLogicVector("0010", 2, 4)));
+	EXPECT_FALSE(dut.Matches(StdLogicVector("1011", 2, 4)));
+	EXPECT_FALSE(dut.Matches(StdLogicVector("01010", 2, 5)));
+
+	// Test case 2: Each hexadecimal '-' covers four bits.
+	EXPECT_TRUE(hex.Matches(StdLogicVector(0xDEAD5EEFull, 32)));
+	EXPECT_TRUE(hex.Matches(StdLogicVector(0xDEADAEEFull, 32)));
+	EXPECT_FALSE(hex.Matches(StdLogicVector(0xDEAD5EEEull, 32)));
+
+	// Test case 3: Values of different sizes (i.e., the most significant bit
+	// is a don't care).
+	StdLogicVectorPattern top(StdLogicVector(0x0123456789ABCDEFull, 300),
+			StdLogicVector(1, 300).ShiftLeft(299).Xor(StdLogicVector(
+			string(75, 'F'), 16, 300)));
+	EXPECT_TRUE(top.Matches(wide));
+	EXPECT_FALSE(StdLogicVectorPattern(StdLogicVector(0x0123456789ABCDEFull,
+			300)).Matches(wide));
+	EXPECT_TRUE(StdLogicVectorPattern(wide).Matches(wide));
+
+	// Test case 4: Patterns shorter than their length compare the implied
+	// leading zeros.
+	StdLogicVectorPattern shorter("1--0", 2, 8);
+	EXPECT_EQ("00001--0", shorter.ToString());
+	EXPECT_TRUE(shorter.Matches(StdLogicVector("00001010", 2, 8)));
+	EXPECT_FALSE(shorter.Matches(StdLogicVector("11111100", 2, 8)));
+	EXPECT_TRUE(StdLogicVectorPattern("-EEF", 16, 32).Matches(StdLogicVector(
+			0x5EEFull, 32)));
+	EXPECT_FALSE(StdLogicVectorPattern("-EEF", 16, 32).Matches(StdLogicVector(
+			0x10005EEFull, 32)));
+
+	// Test case 5: Unsupported bases.
+	EXPECT_THROW(StdLogicVectorPattern("12-4", 10, 16), invalid_argument);
+	EXPECT_THROW(StdLogicVectorPattern("1-", 3, 4), invalid_argument);
+}
+
+// Test checking a batch of values against expected values and care masks.
+TEST(StdLogicVectorPatterns, FindMismatches) {
+
+	int widths[] = {40, 64, 300};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		StdLogicVectorArray actual(1000, widths[w]), expected(1000, widths[w]);
+		StdLogicVectorArray care(1000, widths[w]);
+		StdLogicVector mask = StdLogicVector(string((widths[w] + 3) / 4, 'F'), 16,
+				widths[w]).Xor(StdLogicVector(0xF, widths[w]));
+		vector<size_t> exp;
+
+		for (int i = 0; i < 1000; ++i) {
+			expected[i] = StdLogicVector(0x9E3779B97F4A7C15ull * (i + 1), 64);
+			care[i]     = mask;
+			actual[i]   = expected.getElement(i);
+			// Flip a cared bit of every 7th element, and a don't-care bit of every
+			// 5th element.
+			if ( i % 7 == 3 ) {
+				actual[i] = expected.getElement(i).Xor(StdLogicVector(1,
+						widths[w]).ShiftLeft(4 + i % (widths[w] - 4)));
+				exp.push_back(i);
+			} else if ( i % 5 == 0 ) {
+				actual[i] = expected.getElement(i).Xor(StdLogicVector(1 << (i % 4), 64));
+			}
+		}
+		EXPECT_EQ(exp, actual.FindMismatches(expected, care)) << widths[w];
+		EXPECT_TRUE(actual.FindMismatches(expected, StdLogicVectorArray(1000,
+				widths[w] + 1)).empty());
+	}
+}
+
+
+// ****************************************************************************
+// Bitslice Tests
+// ****************************************************************************
+// Test transposing batches of vectors into bitsliced form and back.
+TEST(StdLogicVectorBitslices, Transpose) {
+
+	int counts[] = {1, 64, 200, 511};
+	int widths[] = {1, 64, 100, 130};
+
+	for (unsigned int c = 0; c < sizeof(counts)/sizeof(counts[0]); ++c) {
+		for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+			StdLogicVectorArray inputs(counts[c], widths[w]);
+			StdLogicVectorArray outputs;
+			StdLogicVectorBitslice dut;
+
+			for (int i = 0; i < counts[c]; ++i) {
+				inputs[i] = StdLogicVector(0x9E3779B97F4A7C15ull * (i + 1), 64).ShiftLeft(
+						i % 97).Xor(StdLogicVector(0xC2B2AE3D27D4EB4Full * i, 64));
+			}
+			dut = StdLogicVectorBitslice::FromArray(inputs);
+			EXPECT_EQ(widths[w], dut.getLength());
+			EXPECT_EQ((counts[c] + 63) / 64 * 64, dut.getLanes());
+
+			// Bit i of instance j is bit j of slice i.
+			EXPECT_EQ(inputs[counts[c] - 1].TestBit(widths[w] - 1),
+					dut.Slice(widths[w] - 1).TestBit(counts[c] - 1));
+			EXPECT_EQ(inputs.getElement(counts[c] / 2), dut.getLane(counts[c] / 2));
+
+			outputs = dut.ToArray();
+			EXPECT_EQ(dut.getLanes(), static_cast<int>(outputs.getCount()));
+			for (int i = 0; i < counts[c]; ++i) {
+				EXPECT_EQ(inputs.getElement(i), outputs.getElement(i))
+						<< counts[c] << " x " << widths[w] << ", element " << i;
+			}
+			if ( counts[c] < dut.getLanes() ) {
+				EXPECT_EQ(StdLogicVector(0, widths[w]),
+						outputs.getElement(dut.getLanes() - 1));
+			}
+		}
+	}
+}
+
+// Test the operations of StdLogicVectorBitslices against those of
+// StdLogicVectors.
+TEST(StdLogicVectorBitslices, MatchStdLogicVector) {
+
+	int widths[] = {1, 37, 64, 100};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		int width = widths[w];
+		StdLogicVectorBitslice a(width, 256), b(width, 256), c;
+		StdLogicVector exp[256], expExtract[256];
+
+		for (int i = 0; i < 256; ++i) {
+			a.setLane(i, StdLogicVector(0x9E3779B97F4A7C15ull * (i + 3), 64).ShiftLeft(
+					i % 41).Xor(StdLogicVector(0xC2B2AE3D27D4EB4Full * i, 64)));
+			b.setLane(i, StdLogicVector(0x165667B19E3779F9ull * (i + 1), 64).Or(
+					StdLogicVector(i, 64)));
+			exp[i] = a.getLane(i);
+			exp[i].setWrapping(true);
+			exp[i].Xor(b.getLane(i)).ShiftLeft(width / 3).And(b.getLane(i));
+			exp[i].ShiftRight(5).Or(b.getLane(i)).ReverseBitOrder();
+			exp[i].ReplaceBits(width / 2, b.getLane(i).Extract(width / 4, 0));
+			expExtract[i] = exp[i].Extract(width - 2, width / 5);
+			exp[i].TruncateAfter(width - width / 4);
+		}
+		a.Xor(b).ShiftLeft(width / 3).And(b).ShiftRight(5).Or(b).ReverseBitOrder();
+		a.ReplaceBits(width / 2, b.Extract(width / 4, 0));
+		c = a.Extract(width - 2, width / 5);
+		a.TruncateAfter(width - width / 4);
+
+		for (int i = 0; i < 256; ++i) {
+			EXPECT_EQ(exp[i], a.getLane(i)) << "width " << width << ", lane " << i;
+			EXPECT_EQ(expExtract[i], c.getLane(i));
+		}
+	}
+}
+
+
+// ****************************************************************************
+// Expression Tests
+// ****************************************************************************
+// Test expressions against the corresponding chains of operations.
+TEST(StdLogicVectorExpressions, MatchStdLogicVector) {
+
+	int widths[] = {1, 37, 64, 100, 256, 300};
+
+	for (unsigned int w = 0; w < sizeof(widths)/sizeof(widths[0]); ++w) {
+		for (int wrap = 0; wrap < 2; ++wrap) {
+			int width = widths[w];
+			StdLogicVector a = StdLogicVector(0x9E3779B97F4A7C15ull, width).ShiftLeft(
+					width / 2).Xor(StdLogicVector(0xC2B2AE3D27D4EB4Full, 64));
+			StdLogicVector b = StdLogicVector(0x165667B19E3779F9ull, width).ShiftLeft(
+					width / 3);
+			StdLogicVector c = StdLogicVector(0x27D4EB2F165667C5ull, width);
+			StdLogicVector act, exp;
+
+			a.setWrapping(wrap);
+			a.TruncateAfter(width);
+			b.TruncateAfter(width);
+			c.TruncateAfter(width);
+
+			// Test case 1: And(a ^ b, c << 3)
+			act = And(a ^ b, c << 3);
+			exp = StdLogicVector(a).Xor(b).And(StdLogicVector(c).ShiftLeft(3));
+			EXPECT_EQ(exp, act) << "width " << width << ", wrap " << wrap;
+			EXPECT_EQ(wrap != 0, act.isWrapping());
+
+			// Test case 2: ((a << 70) | b) >> 5 ^ (c >> 1)
+			act = ((a << 70) | b) >> 5 ^ (c >> 1);
+			exp = StdLogicVector(a).ShiftLeft(70).Or(b).ShiftRight(5).Xor(
+					StdLogicVector(c).ShiftRight(1));
+			EXPECT_EQ(exp, act) << "width " << width << ", wrap " << wrap;
+
+			// Test case 3: Operands may be assigned to (i.e., a = a ^ (a << 1)).
+			exp = StdLogicVector(a).Xor(StdLogicVector(a).ShiftLeft(1));
+			a = a ^ (a << 1);
+			EXPECT_EQ(exp, a) << "width " << width << ", wrap " << wrap;
+		}
+	}
+}
+
+// Test expressions of views, stored expressions and the remaining
+// concatenation.
+TEST(StdLogicVectorExpressions, Operands) {
+
+	StdLogicVector a("0123456789ABCDEF0123456789ABCDEF", 16, 128);
+	StdLogicVector b("FEDCBA9876543210", 16, 64);
+
+	// Test case 1: Views are operands.
+	StdLogicVector act = a.Slice(127, 64) ^ b;
+	EXPECT_EQ(StdLogicVector("FFFFFFFFFFFFFFFF", 16, 64), act);
+	act = And(a.Slice(63, 0) << 4, b ^ b.Slice(63, 32));
+	EXPECT_EQ(StdLogicVector("123456789ABCDEF0", 16, 64).And(
+			StdLogicVector("FEDCBA9888888888", 16, 64)), act);
+
+	// Test case 2: Expressions may be stored.
+	auto expression = (a >> 64) | (b << 64);
+	EXPECT_EQ(StdLogicVector("FEDCBA98765432100123456789ABCDEF", 16, 128),
+			StdLogicVector(expression));
+
+	// Test case 3: The & of two StdLogicVectors remains a concatenation, while
+	// And() is a bitwise AND of the width of its left operand.
+	act = a & b;
+	EXPECT_EQ(192, act.getLength());
+	act = And(a.Slice(63, 0), b);
+	EXPECT_EQ(64, act.getLength());
+	EXPECT_EQ(StdLogicVector("0123456789ABCDEF", 16, 64).And(b), act);
+	act = And(a, b);
+	EXPECT_EQ(128, act.getLength());
+	EXPECT_EQ(StdLogicVector(a).And(b), act);
+}
+
+
+// ****************************************************************************
+// Nine-Valued Vector Tests
+// ****************************************************************************
+// Test the logical operations of StdULogicVectors against the IEEE 1164
+// tables, covering all 81 combinations of values (twice, spanning several
+// limbs).
+TEST(StdULogicVectorOperations, Tables) {
+
+	const string values = "UX01ZWLH-";
+	const string andTable = "UU0UUU0UU" "UX0XXX0XX" "000000000" "UX01XX01X"
+			"UX0XXX0XX" "UX0XXX0XX" "000000000" "UX01XX01X" "UX0XXX0XX";
+	const string orTable  = "UUU1UUU1U" "UXX1XXX1X" "UX01XX01X" "111111111"
+			"UXX1XXX1X" "UXX1XXX1X" "UX01XX01X" "111111111" "UXX1XXX1X";
+	const string xorTable = "UUUUUUUUU" "UXXXXXXXX" "UX01XX01X" "UX10XX10X"
+			"UXXXXXXXX" "UXXXXXXXX" "UX01XX01X" "UX10XX10X" "UXXXXXXXX";
+	const string resolved = "UUUUUUUUU" "UXXXXXXXX" "UX0X0000X" "UXX11111X"
+			"UX01ZWLHX" "UX01WWWWX" "UX01LWLWX" "UX01HWWHX" "UXXXXXXXX";
+	const string notTable = "UX10XX10X";
+	string a, b, expAnd, expOr, expXor, expResolved, expNot;
+
+	// Strings are MSB first, i.e., the combinations are listed in reverse.
+	for (int k = 0; k < 2; ++k) {
+		for (int i = 0; i < 9; ++i) {
+			for (int j = 0; j < 9; ++j) {
+				a.insert(a.begin(), values[i]);
+				b.insert(b.begin(), values[j]);
+				expAnd.insert(expAnd.begin(), andTable[i * 9 + j]);
+				expOr.insert(expOr.begin(), orTable[i * 9 + j]);
+				expXor.insert(expXor.begin(), xorTable[i * 9 + j]);
+				expResolved.insert(expResolved.begin(), resolved[i * 9 + j]);
+				expNot.insert(expNot.begin(), notTable[i]);
+			}
+		}
+	}
+
+	EXPECT_EQ(a, StdULogicVector(a).ToString());
+	EXPECT_EQ(expAnd, StdULogicVector(a).And(StdULogicVector(b)).ToString());
+	EXPECT_EQ(expOr, StdULogicVector(a).Or(StdULogicVector(b)).ToString());
+	EXPECT_EQ(expXor, StdULogicVector(a).Xor(StdULogicVector(b)).ToString());
+	EXPECT_EQ(expResolved,
+			StdULogicVector(a).Resolve(StdULogicVector(b)).ToString());
+	EXPECT_EQ(expNot, StdULogicVector(a).Not().ToString());
+}
+
+// Test the conversions between StdULogicVectors and StdLogicVectors.
+TEST(StdULogicVectorOperations, Conversion) {
+
+	StdLogicVector value("123456789ABCDEF01", 16, 70);
+	StdULogicVector dut(value);
+
+	// Test case 1: Two-valued vectors are never unknown.
+	EXPECT_EQ(70, dut.getLength());
+	EXPECT_FALSE(dut.IsX());
+	EXPECT_EQ(value, dut.ToStdLogicVector());
+
+	// Test case 2: Unknown bits become 0, weak ones keep their value.
+	dut.setBit(0, 'Z');
+	dut.setBit(69, 'H');
+	dut.setBit(68, 'l');
+	EXPECT_TRUE(dut.IsX());
+	EXPECT_EQ('Z', dut.getBit(0));
+	EXPECT_EQ(StdLogicVector("2123456789ABCDEF00", 16, 70),
+			dut.ToStdLogicVector());
+
+	// Test case 3: Vectors default to U and mismatching lengths are ignored.
+	EXPECT_EQ(string(3, 'U'), StdULogicVector(3).ToString());
+	EXPECT_EQ(dut, StdULogicVector(dut).And(StdULogicVector(3)));
+	EXPECT_EQ(StdULogicVector("ZZ"), StdULogicVector(2, 'z'));
+}
+
+
+// ****************************************************************************
+// Fixed-Width Vector Tests
+// ****************************************************************************
+// Operations on FixedLogicVectors can be folded at compile time.
+static_assert(FixedLogicVector<8>(0xF0).ReverseBitOrder() ==
+    FixedLogicVector<8>(0x0F), "constexpr ReverseBitOrder");
+static_assert(FixedLogicVector<12>(0xFFF).Add(FixedLogicVector<12>(1)) ==
+    FixedLogicVector<12>(0), "constexpr Add");
+static_assert(FixedLogicVector<12>(0).Sub(FixedLogicVector<12>(1)) ==
+    FixedLogicVector<12>(0xFFF), "constexpr Sub");
+static_assert(FixedLogicVector<12>(0x123).Mul(FixedLogicVector<12>(0x10)) ==
+    FixedLogicVector<12>(0x230), "constexpr Mul");
+static_assert(FixedLogicVector<130>(1).ShiftLeft(129).TestBit(129) == 1,
+    "constexpr ShiftLeft");
+static_assert(FixedLogicVector<8>(0x81).RotateLeft(1) ==
+    FixedLogicVector<8>(0x03), "constexpr RotateLeft");
+
+// Test the conversion between FixedLogicVectors and StdLogicVectors.
+TEST(FixedLogicVectorOperations, Conversion) {
+
+	StdLogicVector dut, actOutp;
+
+	// Test case 1
+	dut			= StdLogicVector("37BC2013ADE74CAA11204ABCDEF0123456789", 16, 150);
+	actOutp	= FixedLogicVector<150>(dut).ToStdLogicVector();
+	EXPECT_EQ(dut, actOutp);
+
+	// Test case 2
+	dut			= StdLogicVector("1010001110101", 2, 13);
+	EXPECT_EQ("1010001110101", FixedLogicVector<13>(dut).ToString(2));
+	EXPECT_EQ(5237, FixedLogicVector<13>("1010001110101", 2).ToULL());
+}
+
+// Test the operations of FixedLogicVectors against those of StdLogicVectors.
+TEST(FixedLogicVectorOperations, MatchStdLogicVector) {
+
+	StdLogicVector inp1, inp2, expOutp;
+	FixedLogicVector<200> fix1, fix2;
+
+	inp1 = StdLogicVector("B7" + string(46, '3') + "5", 16, 200);
+	inp2 = StdLogicVector("9" + string(48, 'C') + "1", 16, 200);
+	fix1 = FixedLogicVector<200>(inp1);
+	fix2 = FixedLogicVector<200>(inp2);
+
+	// Test case 1: Bitwise operations
+	expOutp = inp1;
+	expOutp.Xor(inp2).And(StdLogicVector(inp1).ShiftRight(7)).Or(inp2);
+	EXPECT_EQ(expOutp, FixedLogicVector<200>(fix1).Xor(fix2).And(
+			FixedLogicVector<200>(fix1).ShiftRight(7)).Or(fix2).ToStdLogicVector());
+
+	// Test case 2: Arithmetic
+	expOutp = inp1;
+	expOutp.Add(inp2);
+	EXPECT_EQ(expOutp, FixedLogicVector<200>(fix1).Add(fix2).ToStdLogicVector());
+	expOutp = inp1;
+	expOutp.Sub(inp2);
+	EXPECT_EQ(expOutp, FixedLogicVector<200>(fix1).Sub(fix2).ToStdLogicVector());
+	expOutp = inp1;
+	expOutp.Negate();
+	EXPECT_EQ(expOutp, FixedLogicVector<200>(fix1).Negate().ToStdLogicVector());
+	expOutp = inp1;
+	expOutp.Mul(inp2);
+	EXPECT_EQ(expOutp, FixedLogicVector<200>(fix1).Mul(fix2).ToStdLogicVector());
+
+	// Test case 3: Shift left with truncation
+	expOutp = inp1;
+	expOutp.ShiftLeft(77).TruncateAfter(200);
+	EXPECT_EQ(expOutp,
+			FixedLogicVector<200>(fix1).ShiftLeft(77).ToStdLogicVector());
+	expOutp = inp1;
+	expOutp.RotateRight(77);
+	EXPECT_EQ(expOutp,
+			FixedLogicVector<200>(fix1).RotateRight(77).ToStdLogicVector());
+
+	// Test case 4: Reversal and replacement of bits
+	expOutp = StdLogicVector("010011001010001111", 2, 18);
+	expOutp.ReverseBitOrder().ReplaceBits(7, StdLogicVector("10011110", 2, 8));
+	EXPECT_EQ(expOutp, FixedLogicVector<18>("010011001010001111", 2).
+			ReverseBitOrder().ReplaceBits(7, FixedLogicVector<8>(0x9E)).
+			ToStdLogicVector());
+}
+
+
+// ****************************************************************************
+// Leakage Tests
+// ****************************************************************************
+// Test recording Hamming-weight and Hamming-distance traces.
+TEST(StdLogicVectorLeakages, Recording) {
+
+	StdLogicVectorLeakage weight(StdLogicVectorLeakage::kHammingWeight, 4, 0.0);
+	StdLogicVectorLeakage distance(StdLogicVectorLeakage::kHammingDistance, 4,
+			0.0);
+	StdLogicVectorLeakage noisy(StdLogicVectorLeakage::kHammingWeight, 20000,
+			2.0);
+	StdLogicVector wide = StdLogicVector(string(75, 'F'), 16, 300);
+	int w0 = weight.AddProbe(StdLogicVector(8));
+	int w1 = weight.AddProbe(StdLogicVector(300));
+	int d0 = distance.AddProbe(StdLogicVector(0x0F, 8));
+	int d1 = distance.AddProbe(StdLogicVector(300));
+
+	// Test case 1: Each sample sums the Hamming weights of its cycle. Cycles
+	// beyond the number of samples are discarded.
+	weight.Leak(w0, StdLogicVector(0xFF, 8));
+	weight.Leak(w1, wide);
+	weight.Clock();
+	weight.Clock();
+	weight.Leak(w1, StdLogicVector(0x7, 300));
+	weight.Leak(7, wide);
+	weight.Clock();
+	for (int i = 0; i < 3; ++i) {
+		weight.Leak(w0, StdLogicVector(1, 8));
+		weight.Clock();
+	}
+	EXPECT_EQ(6, weight.getCycle());
+	EXPECT_EQ(308.0f, weight.getSamples()[0]);
+	EXPECT_EQ(0.0f, weight.getSamples()[1]);
+	EXPECT_EQ(3.0f, weight.getSamples()[2]);
+	EXPECT_EQ(1.0f, weight.getSamples()[3]);
+
+	// Test case 2: Hamming distances start at the initial value of each probe,
+	// also after resetting the trace.
+	for (int trace = 0; trace < 2; ++trace) {
+		distance.Reset(trace);
+		distance.Leak(d0, StdLogicVector(0xFF, 8));
+		distance.Leak(d1, wide);
+		distance.Clock();
+		distance.Leak(d0, StdLogicVector(0xFF, 8));
+		distance.Clock();
+		distance.Leak(d1, wide.Extract(149, 0));
+		distance.Clock();
+		EXPECT_EQ(3, distance.getCycle());
+		EXPECT_EQ(304.0f, distance.getSamples()[0]);
+		EXPECT_EQ(0.0f, distance.getSamples()[1]);
+		EXPECT_EQ(150.0f, distance.getSamples()[2]);
+		EXPECT_EQ(0.0f, distance.getSamples()[3]);
+	}
+
+	// Test case 3: Gaussian noise of the given standard deviation, being the
+	// same for the same seed.
+	double sum = 0.0, squares = 0.0;
+	vector<float> first;
+	noisy.AddProbe(StdLogicVector(8));
+	for (int trace = 0; trace < 2; ++trace) {
+		noisy.Reset(42);
+		for (int i = 0; i < noisy.getSampleCount(); ++i) {
+			noisy.Leak(0, StdLogicVector(0x0F, 8));
+			noisy.Clock();
+		}
+		if ( trace == 0 ) {
+			first.assign(noisy.getSamples(), noisy.getSamples() + 20000);
+		}
+	}
+	for (int i = 0; i < noisy.getSampleCount(); ++i) {
+		EXPECT_EQ(first[i], noisy.getSamples()[i]);
+		sum     += noisy.getSamples()[i] - 4.0;
+		squares += (noisy.getSamples()[i] - 4.0) * (noisy.getSamples()[i] - 4.0);
+	}
+	EXPECT_NEAR(0.0, sum / 20000, 0.1);
+	EXPECT_NEAR(2.0, sqrt(squares / 20000), 0.1);
+}
+
+// Test streaming traces into a binary trace file.
+TEST(StdLogicVectorLeakages, GenerateTraces) {
+
+	StdLogicVectorLeakage dut(StdLogicVectorLeakage::kHammingDistance, 16, 0.5);
+	int probe = dut.AddProbe(StdLogicVector(64));
+	size_t traces = 1000;
+	// Model: a 64-bit register accumulating the trace index in each cycle.
+	StdLogicVectorLeakage::TraceModel model = [&](size_t _trace,
+			StdLogicVectorLeakage & _leakage) {
+		StdLogicVector state(64);
+
+		state.setWrapping(true);
+		for (int i = 0; i < 16; ++i) {
+			state.Add(StdLogicVector(0x9E3779B97F4A7C15ull * (_trace + 1), 64));
+			_leakage.Leak(probe, state);
+			_leakage.Clock();
+		}
+	};
+	ostringstream single, multi, quantized;
+
+	// Test case 1: The header and the samples of each trace.
+	ASSERT_TRUE(dut.GenerateTraces(single, traces, 7,
+			StdLogicVectorLeakage::kFloat32, 1.0f, 1, model));
+	string file = single.str();
+	ASSERT_EQ(StdLogicVectorLeakage::kHeaderSize + traces * 16 * sizeof(float),
+			file.size());
+	uint32_t samples;
+	uint64_t count;
+	EXPECT_EQ("SLVT", file.substr(0, 4));
+	memcpy(&samples, file.data() + 8, sizeof(samples));
+	memcpy(&count, file.data() + 16, sizeof(count));
+	EXPECT_EQ(16u, samples);
+	EXPECT_EQ(traces, count);
+
+	StdLogicVectorLeakage reference(dut);
+	for (size_t t = 0; t < traces; t += 333) {
+		float expected[16];
+
+		reference.Reset(7 + t);
+		model(t, reference);
+		memcpy(expected, file.data() + StdLogicVectorLeakage::kHeaderSize +
+				t * sizeof(expected), sizeof(expected));
+		for (int i = 0; i < 16; ++i) {
+			EXPECT_EQ(reference.getSamples()[i], expected[i]) << t << " " << i;
+		}
+	}
+
+	// Test case 2: The file does not depend on the number of threads.
+	ASSERT_TRUE(dut.GenerateTraces(multi, traces, 7,
+			StdLogicVectorLeakage::kFloat32, 1.0f, 4, model));
+	EXPECT_TRUE(file == multi.str());
+
+	// Test case 3: Scaled and saturated int16 samples.
+	ASSERT_TRUE(dut.GenerateTraces(quantized, traces, 7,
+			StdLogicVectorLeakage::kInt16, 1000.0f, 3, model));
+	string shorts = quantized.str();
+	ASSERT_EQ(StdLogicVectorLeakage::kHeaderSize + traces * 16 * sizeof(int16_t),
+			shorts.size());
+	for (size_t i = 0; i < traces * 16; i += 97) {
+		float sample;
+		int16_t actual;
+
+		memcpy(&sample, file.data() + StdLogicVectorLeakage::kHeaderSize +
+				i * sizeof(float), sizeof(sample));
+		memcpy(&actual, shorts.data() + StdLogicVectorLeakage::kHeaderSize +
+				i * sizeof(int16_t), sizeof(actual));
+		EXPECT_EQ(min(max(nearbyintf(sample * 1000.0f), -32768.0f), 32767.0f),
+				actual) << i;
+	}
+
+	// Test case 4: Exceptions of the model are passed on to the caller.
+	StdLogicVectorLeakage::TraceModel failing = [&](size_t _trace,
+			StdLogicVectorLeakage & _leakage) {
+		if ( _trace == 500 ) {
+			throw runtime_error("trace 500");
+		}
+		model(_trace, _leakage);
+	};
+	for (int threads = 1; threads <= 4; threads += 3) {
+		ostringstream aborted;
+
+		EXPECT_THROW(dut.GenerateTraces(aborted, traces, 7,
+				StdLogicVectorLeakage::kFloat32, 1.0f, threads, failing),
+				runtime_error) << threads;
+		EXPECT_GT(file.size(), aborted.str().size()) << threads;
+	}
+}
+
+
+// ****************************************************************************
+// Arena Tests
+// ****************************************************************************
+/**
+ * @brief Runs the checks of the pooled memory functions. Since these replace
+ *   the memory functions of GMP for good, the checks run within a child
+ *   process, returning the number of failed checks.
+ */
+static int ArenaChecks() {
+	int failures = 0;
+	auto check = [&](bool _condition, const char * _name) {
+		if ( !_condition ) {
+			fprintf(stderr, "Check failed: %s\n", _name);
+			++failures;
+		}
+	};
+
+	StdLogicVectorArena::Install();
+	check(StdLogicVectorArena::isInstalled(), "installed");
+	StdLogicVector wide = StdLogicVector(string(256, 'A'), 16, 1024);
+
+	// Test case 1: Released storage is reused from the free lists.
+	StdLogicVector product = StdLogicVector(wide).Mul(wide);
+	StdLogicVectorArena::Statistics before = StdLogicVectorArena::getStatistics();
+	for (int i = 0; i < 100; ++i) {
+		StdLogicVector copy(wide);
+		check(copy.Mul(wide) == product, "pooled product");
+	}
+	StdLogicVectorArena::Statistics after = StdLogicVectorArena::getStatistics();
+	check(after.allocations >= before.allocations + 100, "allocations");
+	check(after.pooled >= before.pooled + 99, "pooled");
+	check(after.system <= before.system + 2, "system");
+
+	// Test case 2: Temporaries of a scope are taken from its arena, also when
+	// being moved out of the scope.
+	StdLogicVector kept;
+	before = StdLogicVectorArena::getStatistics();
+	for (int cycle = 0; cycle < 10; ++cycle) {
+		StdLogicVectorArena scope;
+		StdLogicVector copy(wide);
+
+		copy.Mul(wide);
+		check(copy == product, "arena product");
+		check(scope.getBytes() > 0, "arena bytes");
+		if ( cycle == 3 ) {
+			kept = move(copy);
+		}
+	}
+	after = StdLogicVectorArena::getStatistics();
+	check(after.arena >= before.arena + 10, "arena");
+	check(kept == product, "kept product");
+	kept = StdLogicVector();
+
+	// Test case 3: Storage returned by GMP is released using its memory
+	// functions.
+	void (*release)(void *, size_t);
+	char * digits = mpz_get_str(NULL, 16, wide.getValue());
+	check(string(digits) == string(256, 'a'), "digits");
+	mp_get_memory_functions(NULL, NULL, &release);
+	release(digits, strlen(digits) + 1);
+
+	// Test case 4: The statistics include terminated threads.
+	before = StdLogicVectorArena::getStatistics();
+	vector<thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&]() {
+			for (int i = 0; i < 100; ++i) {
+				StdLogicVectorArena scope;
+				StdLogicVector copy(wide);
+
+				copy.Mul(wide);
+			}
+		});
+	}
+	for (size_t t = 0; t < threads.size(); ++t) {
+		threads[t].join();
+	}
+	after = StdLogicVectorArena::getStatistics();
+	check(after.arena >= before.arena + 400, "thread arena");
+	check(after.frees - before.frees == after.allocations - before.allocations,
+			"thread frees");
+	return failures;
+}
+
+// Test the pooled memory functions and the arenas.
+TEST(StdLogicVectorArenas, MemoryFunctions) {
+	EXPECT_EXIT(exit(ArenaChecks()), ::testing::ExitedWithCode(0), "");
+}
+
+
+// ****************************************************************************
+// Thread Pool Tests
+// ****************************************************************************
+// Test that the parallel operations process each index exactly once.
+TEST(StdLogicVectorThreadPools, ParallelFor) {
+
+	StdLogicVectorThreadPool pool(4);
+	size_t counts[] = {0, 1, 3, 1000, 100000};
+	size_t grains[] = {0, 1, 64};
+
+	EXPECT_EQ(4, pool.getThreadCount());
+	for (unsigned int c = 0; c < sizeof(counts)/sizeof(counts[0]); ++c) {
+		for (unsigned int g = 0; g < sizeof(grains)/sizeof(grains[0]); ++g) {
+			vector<atomic<int> > visits(counts[c]);
+
+			pool.ParallelFor(counts[c], grains[g], [&](size_t _begin,
+					size_t _end) {
+				for (size_t i = _begin; i < _end; ++i) {
+					++visits[i];
+				}
+			});
+			int wrong = 0;
+			for (size_t i = 0; i < counts[c]; ++i) {
+				wrong += (visits[i] != 1);
+			}
+			EXPECT_EQ(0, wrong) << counts[c] << " " << grains[g];
+		}
+	}
+
+	// Test case 2: Nested operations (with more tasks than workers).
+	atomic<size_t> sum(0);
+	pool.ParallelFor(16, 1, [&](size_t _begin, size_t _end) {
+		for (size_t i = _begin; i < _end; ++i) {
+			pool.ParallelFor(100, 7, [&](size_t _b, size_t _e) {
+				for (size_t j = _b; j < _e; ++j) {
+					sum += i * 100 + j;
+				}
+			});
+		}
+	});
+	EXPECT_EQ(1600 * 1599 / 2, sum);
+
+	// Test case 3: Exceptions are passed on to the caller.
+	EXPECT_THROW(pool.ParallelFor(1000, 10, [&](size_t _begin, size_t _end) {
+		if ( _begin <= 500 && 500 < _end ) {
+			throw runtime_error("index 500");
+		}
+	}), runtime_error);
+}
+
+// Test mapping batches of vectors in parallel.
+TEST(StdLogicVectorThreadPools, ParallelMap) {
+
+	StdLogicVectorThreadPool pool(3);
+	StdLogicVector key(string(32, 'C'), 16, 128);
+	vector<StdLogicVector> inputs;
+	StdLogicVectorArray array(1000, 72);
+
+	for (int i = 0; i < 1000; ++i) {
+		inputs.push_back(StdLogicVector(0x9E3779B97F4A7C15ull * (i + 1), 128));
+		array[i] = StdLogicVector(i, 72);
+	}
+
+	// Test case 1: Results in the order of the inputs, with all threads reading
+	// the same key.
+	vector<StdLogicVector> sums = pool.ParallelMap(inputs,
+			[&](const StdLogicVector & _input) {
+		StdLogicVector sum(_input);
+
+		sum.setWrapping(true);
+		return sum.Xor(key).Add(_input);
+	});
+	vector<string> strings = pool.ParallelMap(inputs,
+			[&](const StdLogicVector & _input) {
+		return _input.ToString(16, true) + key.ToString(16, true);
+	});
+	ASSERT_EQ(inputs.size(), sums.size());
+	for (size_t i = 0; i < inputs.size(); ++i) {
+		StdLogicVector expected(inputs[i]);
+
+		expected.setWrapping(true);
+		expected.Xor(key).Add(inputs[i]);
+		EXPECT_EQ(expected, sums[i]) << i;
+		EXPECT_EQ(inputs[i].ToString(16, true) + key.ToString(16, true),
+				strings[i]) << i;
+	}
+
+	// Test case 2: Modifying each element of a vector and of an array.
+	pool.ParallelForEach(inputs, [&](StdLogicVector & _item) {
+		_item.Xor(key);
+	});
+	pool.ParallelForEach(array, [&](StdLogicVectorView _element) {
+		_element = _element.ToStdLogicVector().Or(StdLogicVector(1, 72).ShiftLeft(
+				64));
+	});
+	for (size_t i = 0; i < inputs.size(); ++i) {
+		EXPECT_EQ(StdLogicVector(sums[i]).Sub(StdLogicVector(0x9E3779B97F4A7C15ull *
+				(i + 1), 128)).TruncateAfter(128), inputs[i]) << i;
+		EXPECT_EQ(StdLogicVector(i, 72).Or(StdLogicVector(1, 72).ShiftLeft(64)),
+				array.getElement(i)) << i;
+	}
+}
+
 
 // ****************************************************************************
 // Main function initiating all tests previously set up.
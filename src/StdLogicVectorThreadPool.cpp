@@ -0,0 +1,316 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorThreadPool.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief Parallel operations on batches of StdLogicVectors
+ * @version 0.1
+ *
+ * A parallel operation initially hands one contiguous block of its indices
+ * to each worker. A worker executing a subrange larger than the grain of the
+ * operation repeatedly pushes the upper half onto the back of its deque and
+ * continues with the lower half. It later pops these halves from the back
+ * (i.e., the most recently split, cache-warm ones), while idle workers steal
+ * from the front.
+ */
+#include <algorithm>
+#include <deque>
+#include <exception>
+
+#include "StdLogicVectorThreadPool.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Jobs and queues
+// ****************************************************************************
+/**
+ * @brief A parallel operation. The number of remaining indices is counted
+ *   down by the workers, and whoever completes the last index signals the
+ *   caller.
+ */
+struct StdLogicVectorThreadPool::Job {
+	const RangeFunction * func;
+	size_t grain;
+	atomic<size_t> remaining;
+	mutex stateMutex;
+	condition_variable done;
+	bool finished;
+	exception_ptr exception;
+};
+
+/**
+ * @brief Deque of the subranges of a worker (on a cache line of its own).
+ */
+struct alignas(64) StdLogicVectorThreadPool::WorkerQueue {
+	mutex rangesMutex;
+	deque<Range> ranges;
+};
+
+// Pool and index of the worker running on the current thread (if any).
+static thread_local const StdLogicVectorThreadPool * tPool = NULL;
+static thread_local int tWorker = -1;
+
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+/**
+ * @brief Starts a thread pool.
+ * @param _threads The number of worker threads (0 for one per hardware
+ *   thread).
+ */
+StdLogicVectorThreadPool::StdLogicVectorThreadPool(int _threads) :
+		queued_(0), sleeping_(0), stopping_(false)
+{
+	if ( _threads <= 0 ) {
+		_threads = max<int>(thread::hardware_concurrency(), 1);
+	}
+	for (int i = 0; i < _threads; ++i) {
+		queues_.push_back(new WorkerQueue());
+	}
+	for (int i = 0; i < _threads; ++i) {
+		threads_.emplace_back(&StdLogicVectorThreadPool::Work, this, i);
+	}
+}
+
+/**
+ * @brief Completes all pending subranges and stops the worker threads.
+ */
+StdLogicVectorThreadPool::~StdLogicVectorThreadPool() {
+	{
+		lock_guard<mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	wakeup_.notify_all();
+	for (size_t i = 0; i < threads_.size(); ++i) {
+		threads_[i].join();
+	}
+	for (size_t i = 0; i < queues_.size(); ++i) {
+		delete queues_[i];
+	}
+}
+
+/**
+ * @brief Returns the default thread pool, running one worker per hardware
+ *   thread. The pool is started on the first call.
+ */
+StdLogicVectorThreadPool & StdLogicVectorThreadPool::getDefault() {
+	static StdLogicVectorThreadPool pool(0);
+
+	return pool;
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the number of worker threads.
+ */
+int StdLogicVectorThreadPool::getThreadCount() const {
+	return static_cast<int>(threads_.size());
+}
+
+
+// ****************************************************************************
+// Parallel operations
+// ****************************************************************************
+/**
+ * @brief Calls @p _func for subranges covering the indices [0, @p _count)
+ *   in parallel and waits for all of them to complete.
+ * @param _count The number of indices.
+ * @param _grain The largest subrange not split any further (0 to choose it
+ *   such that each worker gets about 16 subranges).
+ * @param _func The function processing the indices [_begin, _end).
+ */
+void StdLogicVectorThreadPool::ParallelFor(size_t _count, size_t _grain,
+		const RangeFunction & _func) {
+	size_t workers = threads_.size();
+	int self = CurrentWorker();
+	Job job;
+
+	if ( _count == 0 ) {
+		return;
+	}
+	job.func = &_func;
+	job.grain = (_grain > 0) ? _grain : max<size_t>(_count / (16 * workers), 1);
+	job.remaining = _count;
+	job.finished = false;
+
+	if ( self >= 0 ) {
+		// Nested operation: the calling worker helps until the job is done.
+		Range range;
+
+		Push(self, Range{ &job, 0, _count });
+		for (;;) {
+			{
+				lock_guard<mutex> lock(job.stateMutex);
+				if ( job.finished ) {
+					break;
+				}
+			}
+			if ( Pop(self, range) || Steal(self, range) ) {
+				Execute(self, range);
+			} else {
+				this_thread::yield();
+			}
+		}
+	} else {
+		size_t blocks = min(workers, _count);
+
+		for (size_t b = 0; b < blocks; ++b) {
+			Push(static_cast<int>(b), Range{ &job, _count * b / blocks,
+					_count * (b + 1) / blocks });
+		}
+		unique_lock<mutex> lock(job.stateMutex);
+		job.done.wait(lock, [&]() { return job.finished; });
+	}
+
+	if ( job.exception ) {
+		rethrow_exception(job.exception);
+	}
+}
+
+
+// ****************************************************************************
+// Workers
+// ****************************************************************************
+/**
+ * @brief Returns the index of the worker running on the current thread, or
+ *   -1 if the current thread is not a worker of this pool.
+ */
+int StdLogicVectorThreadPool::CurrentWorker() const {
+	return (tPool == this) ? tWorker : -1;
+}
+
+/**
+ * @brief Pushes a subrange onto the back of the deque of a worker and wakes
+ *   up a sleeping worker (if any).
+ */
+void StdLogicVectorThreadPool::Push(int _worker, const Range & _range) {
+	{
+		lock_guard<mutex> lock(queues_[_worker]->rangesMutex);
+		queues_[_worker]->ranges.push_back(_range);
+	}
+	++queued_;
+	// Taking the lock ensures that a worker about to sleep either sees the
+	// subrange or already waits for the notification.
+	if ( sleeping_ > 0 ) {
+		{
+			lock_guard<mutex> lock(mutex_);
+		}
+		wakeup_.notify_one();
+	}
+}
+
+/**
+ * @brief Pops the most recently pushed subrange of a worker.
+ */
+bool StdLogicVectorThreadPool::Pop(int _worker, Range & _range) {
+	lock_guard<mutex> lock(queues_[_worker]->rangesMutex);
+
+	if ( queues_[_worker]->ranges.empty() ) {
+		return false;
+	}
+	_range = queues_[_worker]->ranges.back();
+	queues_[_worker]->ranges.pop_back();
+	--queued_;
+	return true;
+}
+
+/**
+ * @brief Steals the oldest subrange of another worker, trying all of them
+ *   starting with the next one.
+ */
+bool StdLogicVectorThreadPool::Steal(int _worker, Range & _range) {
+	size_t workers = queues_.size();
+
+	for (size_t i = 1; i <= workers; ++i) {
+		WorkerQueue * victim = queues_[(_worker + i) % workers];
+		lock_guard<mutex> lock(victim->rangesMutex);
+
+		if ( !victim->ranges.empty() ) {
+			_range = victim->ranges.front();
+			victim->ranges.pop_front();
+			--queued_;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Executes a subrange, splitting off its upper halves down to the
+ *   grain of its job.
+ */
+void StdLogicVectorThreadPool::Execute(int _worker, Range _range) {
+	Job * job = _range.job;
+	size_t count;
+
+	while ( _range.end - _range.begin > job->grain ) {
+		size_t middle = _range.begin + (_range.end - _range.begin) / 2;
+
+		Push(_worker, Range{ job, middle, _range.end });
+		_range.end = middle;
+	}
+	count = _range.end - _range.begin;
+
+	try {
+		(*job->func)(_range.begin, _range.end);
+	} catch (...) {
+		lock_guard<mutex> lock(job->stateMutex);
+		if ( !job->exception ) {
+			job->exception = current_exception();
+		}
+	}
+
+	if ( job->remaining.fetch_sub(count, memory_order_acq_rel) == count ) {
+		lock_guard<mutex> lock(job->stateMutex);
+		job->finished = true;
+		job->done.notify_all();
+	}
+}
+
+/**
+ * @brief Main loop of a worker thread.
+ */
+void StdLogicVectorThreadPool::Work(int _worker) {
+	Range range;
+
+	tPool = this;
+	tWorker = _worker;
+	for (;;) {
+		if ( Pop(_worker, range) || Steal(_worker, range) ) {
+			Execute(_worker, range);
+			continue;
+		}
+
+		unique_lock<mutex> lock(mutex_);
+		++sleeping_;
+		wakeup_.wait(lock, [&]() { return queued_ > 0 || stopping_; });
+		--sleeping_;
+		if ( stopping_ && queued_ == 0 ) {
+			return;
+		}
+	}
+}
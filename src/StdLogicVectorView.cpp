@@ -0,0 +1,425 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdLogicVectorView.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A non-owning view onto a range of bits of a StdLogicVector
+ * @version 0.1
+ *
+ * All operations of a StdLogicVectorView work directly on the limbs of its
+ * parent StdLogicVector (or on the limbs of an element of a
+ * StdLogicVectorArray), one limb of the view at a time.
+ */
+#include <iostream>
+#include <string>
+#include <gmp.h>
+#include <algorithm>
+
+#include "StdLogicVectorView.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Constructors
+// ****************************************************************************
+/**
+ * @brief Creates a read-only view onto the bits @p _hi @c downto @p _lo of a
+ *   StdLogicVector.
+ *
+ * @param _parent The StdLogicVector to refer to.
+ * @param _hi The 0-based index of the most significant bit of the view. The
+ *   view is clipped at the @a length_ of the @p _parent.
+ * @param _lo The 0-based index of the least significant bit of the view.
+ */
+StdLogicVectorConstView::StdLogicVectorConstView(
+		const StdLogicVector & _parent, int _hi, int _lo) : parent_(&_parent),
+		limbs_(NULL), size_(0)
+{
+	lo_     = max(_lo, 0);
+	length_ = max(min(_hi, _parent.getLength() - 1) - lo_ + 1, 0);
+}
+
+/**
+ * @brief Creates a read-only view onto a fixed number of limbs not owned by a
+ *   StdLogicVector (e.g., an element of a StdLogicVectorArray).
+ *
+ * @param _limbs The limbs to refer to.
+ * @param _size The number of limbs.
+ * @param _length The length of the view in bits (at most @p _size limbs).
+ */
+StdLogicVectorConstView::StdLogicVectorConstView(const mp_limb_t * _limbs,
+		mp_size_t _size, int _length) : parent_(NULL), limbs_(_limbs),
+		size_(_size), lo_(0), length_(_length)
+{
+}
+
+/**
+ * @brief Creates a view onto the bits @p _hi @c downto @p _lo of a
+ *   StdLogicVector.
+ *
+ * @param _parent The StdLogicVector to refer to.
+ * @param _hi The 0-based index of the most significant bit of the view. The
+ *   view is clipped at the @a length_ of the @p _parent.
+ * @param _lo The 0-based index of the least significant bit of the view.
+ */
+StdLogicVectorView::StdLogicVectorView(StdLogicVector & _parent, int _hi,
+		int _lo) : StdLogicVectorConstView(_parent, _hi, _lo)
+{
+}
+
+/**
+ * @brief Creates a view onto a fixed number of limbs not owned by a
+ *   StdLogicVector (e.g., an element of a StdLogicVectorArray).
+ *
+ * @param _limbs The limbs to refer to.
+ * @param _size The number of limbs.
+ * @param _length The length of the view in bits (at most @p _size limbs).
+ */
+StdLogicVectorView::StdLogicVectorView(mp_limb_t * _limbs, mp_size_t _size,
+		int _length) : StdLogicVectorConstView(_limbs, _size, _length)
+{
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the length of the view.
+ * @return The number of bits covered by the view.
+ */
+int StdLogicVectorConstView::getLength() const {
+	return length_;
+}
+
+/**
+ * @brief Returns the index of the least significant bit of the view within
+ *   its parent.
+ * @return The 0-based index of the least significant bit.
+ */
+int StdLogicVectorConstView::getLow() const {
+	return lo_;
+}
+
+/**
+ * @brief Returns the StdLogicVector the view refers to.
+ * @return The parent StdLogicVector, or NULL for a view onto an element of a
+ *   StdLogicVectorArray.
+ */
+const StdLogicVector * StdLogicVectorConstView::getParent() const {
+	return parent_;
+}
+
+/**
+ * @brief Determines whether the view refers to the bits of a StdLogicVector.
+ * @param _vector The StdLogicVector to check.
+ * @return True if @p _vector is the parent of the view.
+ */
+bool StdLogicVectorConstView::Overlaps(const StdLogicVector & _vector) const {
+	return parent_ == &_vector;
+}
+
+/**
+ * @brief Returns a single limb of the value of the view.
+ * @param _index The index of the limb (0 is the least significant one).
+ * @return The limb at position @p _index. Bits beyond the length of the view
+ *   are zero.
+ */
+mp_limb_t StdLogicVectorConstView::getLimb(mp_size_t _index) const {
+	mp_bitcnt_t first = static_cast<mp_bitcnt_t>(_index) * GMP_NUMB_BITS;
+	mp_limb_t limb;
+
+	if ( first >= static_cast<mp_bitcnt_t>(length_) ) {
+		return 0;
+	}
+	limb = StdLogicVector::ReadLimb(ReadLimbs(), ReadSize(), lo_ + first);
+	if ( length_ - first < GMP_NUMB_BITS ) {
+		limb &= (static_cast<mp_limb_t>(1) << (length_ - first)) - 1;
+	}
+	return limb;
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+/**
+ * @brief Converts the value of the view into an unsigned long long.
+ * @return The least significant 64 bits of the view.
+ */
+unsigned long long StdLogicVectorConstView::ToULL() const {
+#if GMP_NUMB_BITS >= 64
+	return getLimb(0);
+#else
+	return (static_cast<unsigned long long>(getLimb(1)) << GMP_NUMB_BITS) |
+			getLimb(0);
+#endif
+}
+
+/**
+ * @copydoc StdLogicVector::ToString(int) const
+ */
+string StdLogicVectorConstView::ToString(int _base) const {
+	return ToString(_base, false);
+}
+
+/**
+ * @copydoc StdLogicVector::ToString(int, bool) const
+ */
+string StdLogicVectorConstView::ToString(int _base, bool _pad) const {
+	return ToStdLogicVector().ToString(_base, _pad);
+}
+
+/**
+ * @brief Copies the bits of the view into a new StdLogicVector.
+ * @return A StdLogicVector of the same length and value as the view.
+ */
+StdLogicVector StdLogicVectorConstView::ToStdLogicVector() const {
+	StdLogicVector result(length_);
+	mp_size_t size = StdLogicVector::LimbsForWidth(length_);
+
+	StdLogicVector::DepositBits(result.ModifyLimbs(size), 0, ReadLimbs(),
+			ReadSize(), lo_, length_);
+	result.FinishLimbs(size);
+	return result;
+}
+
+
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+/**
+ * @brief Returns the limbs the view refers to (i.e., those of its parent or
+ *   its own ones).
+ */
+const mp_limb_t * StdLogicVectorConstView::ReadLimbs() const {
+	return parent_ ? mpz_limbs_read(parent_->getValue()) : limbs_;
+}
+
+/**
+ * @brief Returns the number of valid limbs returned by ReadLimbs().
+ */
+mp_size_t StdLogicVectorConstView::ReadSize() const {
+	return parent_ ? static_cast<mp_size_t>(mpz_size(parent_->getValue())) :
+			size_;
+}
+
+/**
+ * @brief Provides write access to the limbs covering the view.
+ * @param _size Set to the number of limbs to be passed to EndWrite().
+ * @return The limbs the view refers to.
+ */
+mp_limb_t * StdLogicVectorView::BeginWrite(mp_size_t & _size) {
+	// The constructors of a StdLogicVectorView only take writable limbs or a
+	// writable parent.
+	if ( parent_ == NULL ) {
+		_size = size_;
+		return const_cast<mp_limb_t *>(limbs_);
+	}
+	_size = max<mp_size_t>(mpz_size(parent_->getValue()),
+			StdLogicVector::LimbsForWidth(lo_ + length_));
+	return const_cast<StdLogicVector *>(parent_)->ModifyLimbs(_size);
+}
+
+/**
+ * @brief Completes a modification started with BeginWrite().
+ */
+void StdLogicVectorView::EndWrite(mp_size_t _size) {
+	if ( parent_ != NULL ) {
+		const_cast<StdLogicVector *>(parent_)->FinishLimbs(_size);
+	}
+}
+
+
+// ****************************************************************************
+// Operator overloadings
+// ****************************************************************************
+/**
+ * @brief Writes the bits of another view into the bits of the parent of this
+ *   view. If @p _input is shorter than this view, the remaining bits are
+ *   cleared.
+ * @param _input The view to be copied.
+ * @return This view.
+ */
+StdLogicVectorView & StdLogicVectorView::operator=(
+		const StdLogicVectorView & _input) {
+	return *this = static_cast<const StdLogicVectorConstView &>(_input);
+}
+
+/**
+ * @brief Writes the bits of a read-only view into the bits of the parent of
+ *   this view (see operator=(const StdLogicVectorView &)).
+ * @param _input The view to be copied.
+ * @return This view.
+ */
+StdLogicVectorView & StdLogicVectorView::operator=(
+		const StdLogicVectorConstView & _input) {
+	mp_size_t size;
+	mp_limb_t * limbs;
+
+	// Overlapping ranges of the same storage are copied via a temporary.
+	if ( parent_ ? _input.parent_ == parent_ : _input.limbs_ == limbs_ ) {
+		return *this = _input.ToStdLogicVector();
+	}
+
+	limbs = BeginWrite(size);
+	StdLogicVector::DepositBits(limbs, lo_, _input.ReadLimbs(),
+			_input.ReadSize(), _input.lo_, min(length_, _input.length_));
+	if ( _input.length_ < length_ ) {
+		StdLogicVector::DepositBits(limbs, lo_ + _input.length_, NULL, 0, 0,
+				length_ - _input.length_);
+	}
+	EndWrite(size);
+
+	return *this;
+}
+
+/**
+ * @brief Writes the bits of a StdLogicVector into the bits of the parent of
+ *   this view. Bits of @p _input beyond the length of the view are ignored,
+ *   while missing bits are cleared.
+ * @param _input The StdLogicVector to be written.
+ * @return This view.
+ */
+StdLogicVectorView & StdLogicVectorView::operator=(
+		const StdLogicVector & _input) {
+	mp_size_t size;
+	mp_limb_t * limbs;
+
+	if ( &_input == parent_ ) {
+		return *this = StdLogicVector(_input);
+	}
+
+	limbs = BeginWrite(size);
+	StdLogicVector::DepositBits(limbs, lo_, mpz_limbs_read(_input.getValue()),
+			mpz_size(_input.getValue()), 0, length_);
+	EndWrite(size);
+
+	return *this;
+}
+
+/**
+ * @brief Writes an unsigned long long into the bits of the parent of this
+ *   view.
+ * @param _value The value to be written (truncated to the length of the
+ *   view).
+ * @return This view.
+ */
+StdLogicVectorView & StdLogicVectorView::operator=(unsigned long long _value) {
+	return *this = StdLogicVector(_value, 64);
+}
+
+/**
+ * @brief Equality operator. Returns true if both the value and the length of
+ *   the two views are identical.
+ */
+bool StdLogicVectorConstView::operator==(
+		const StdLogicVectorConstView & _input) const {
+	if ( length_ != _input.length_ ) {
+		return false;
+	}
+	for (mp_size_t i = 0; i < StdLogicVector::LimbsForWidth(length_); ++i) {
+		if ( getLimb(i) != _input.getLimb(i) ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Inequality operator.
+ */
+bool StdLogicVectorConstView::operator!=(
+		const StdLogicVectorConstView & _input) const {
+	return !(*this == _input);
+}
+
+/**
+ * @brief Equality operator. Returns true if both the value and the length of
+ *   the view and the StdLogicVector are identical.
+ */
+bool StdLogicVectorConstView::operator==(const StdLogicVector & _input)
+		const {
+	const mpz_t & value = _input.getValue();
+	mp_size_t size = StdLogicVector::LimbsForWidth(length_);
+
+	if ( length_ != _input.getLength() ||
+			 static_cast<mp_size_t>(mpz_size(value)) > size ) {
+		return false;
+	}
+	for (mp_size_t i = 0; i < size; ++i) {
+		if ( getLimb(i) != mpz_getlimbn(value, i) ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Inequality operator.
+ */
+bool StdLogicVectorConstView::operator!=(const StdLogicVector & _input)
+		const {
+	return !(*this == _input);
+}
+
+/**
+ * @brief Equality operator with the StdLogicVector on the left-hand side.
+ */
+bool operator==(const StdLogicVector & _input,
+		const StdLogicVectorConstView & _view) {
+	return _view == _input;
+}
+
+/**
+ * @brief Inequality operator with the StdLogicVector on the left-hand side.
+ */
+bool operator!=(const StdLogicVector & _input,
+		const StdLogicVectorConstView & _view) {
+	return _view != _input;
+}
+
+/**
+ * @brief Provide a nice stream output showing the value of the view in
+ *   hexadecimal representation and also its length.
+ */
+ostream & operator<<(ostream & _os, const StdLogicVectorConstView & _view)
+{
+	return _os << _view.ToStdLogicVector();
+}
+
+
+// ****************************************************************************
+// Bitwise operations
+// ****************************************************************************
+/**
+ * @brief Tests a single bit of the view whether it is set or not.
+ * @param _index The index of the bit to be tested (zero-based, relative to the
+ *   least significant bit of the view).
+ * @return 1 if the bit is set, 0 otherwise (also for bits beyond the view).
+ */
+int StdLogicVectorConstView::TestBit(int _index) const {
+	if ( _index < 0 || _index >= length_ ) {
+		return 0;
+	}
+	return StdLogicVector::ReadLimb(ReadLimbs(), ReadSize(), lo_ + _index) & 1;
+}
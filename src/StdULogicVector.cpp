@@ -0,0 +1,420 @@
+/******************************************************************************
+ *
+ * An implementation of the std_logic_vector VHDL data type in C++
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file StdULogicVector.cpp
+ * @author agent (agent@local)
+ * @date 16 October 2026
+ * @brief A nine-valued std_ulogic_vector as defined by IEEE 1164
+ * @version 0.1
+ *
+ * The logical operations combine the planes of both operands according to the
+ * IEEE 1164 tables, using the kernels selected for the host CPU (see
+ * StdLogicVectorKernels.cpp). The tables themselves are only reflected in the
+ * comments of the respective functions.
+ */
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <gmp.h>
+
+#include "StdULogicVector.h"
+#include "StdLogicVectorKernels.h"
+
+using namespace std;
+
+
+// ****************************************************************************
+// Encoding
+// ****************************************************************************
+// The planes of a single value, packed as value | unknown<<1 | weak<<2 |
+// special<<3.
+static const int kCode0    = 0x0;
+static const int kCode1    = 0x1;
+static const int kCodeX    = 0x2;
+static const int kCodeDash = 0x3;
+static const int kCodeL    = 0x4;
+static const int kCodeH    = 0x5;
+static const int kCodeW    = 0x6;
+static const int kCodeU    = 0xA;
+static const int kCodeZ    = 0xE;
+
+// The character of each code (unused codes never occur).
+static const char kCharacters[16] = {
+  '0', '1', 'X', '-', 'L', 'H', 'W', '?', '?', '?', 'U', '?', '?', '?', 'Z', '?'
+};
+
+/**
+ * @brief Returns the code of a std_ulogic character (case-insensitive).
+ *   Invalid characters are treated as @c X.
+ */
+static int CodeOf(char _value) {
+	switch ( _value ) {
+	case '0':            return kCode0;
+	case '1':            return kCode1;
+	case 'L': case 'l':  return kCodeL;
+	case 'H': case 'h':  return kCodeH;
+	case 'W': case 'w':  return kCodeW;
+	case 'U': case 'u':  return kCodeU;
+	case 'Z': case 'z':  return kCodeZ;
+	case '-':            return kCodeDash;
+	default:             return kCodeX;
+	}
+}
+
+/**
+ * @brief Returns a limb of all zeros or all ones, depending on @p _bit.
+ */
+static inline mp_limb_t Spread(int _bit) {
+	return -static_cast<mp_limb_t>(_bit & 1);
+}
+
+
+// ****************************************************************************
+// Constructors
+// ****************************************************************************
+/**
+ * @brief Creates an empty StdULogicVector.
+ */
+StdULogicVector::StdULogicVector() : length_(0)
+{
+}
+
+/**
+ * @brief Creates a StdULogicVector of @p _length bits, all of them
+ *   uninitialized (i.e., @c U, the default value of a VHDL std_ulogic).
+ * @param _length The length of the vector in bits.
+ */
+StdULogicVector::StdULogicVector(int _length) :
+		StdULogicVector(_length, 'U')
+{
+}
+
+/**
+ * @brief Creates a StdULogicVector of @p _length bits, all of them set to
+ *   @p _value.
+ * @param _length The length of the vector in bits.
+ * @param _value The std_ulogic character of all bits (e.g., @c 'Z').
+ */
+StdULogicVector::StdULogicVector(int _length, char _value) :
+		length_(max(_length, 0))
+{
+	mp_size_t blocks = (length_ + kULogicBlockLimbs * GMP_NUMB_BITS - 1) /
+			(kULogicBlockLimbs * GMP_NUMB_BITS);
+	int code = CodeOf(_value);
+
+	planes_ = StdLogicVectorArray(4, blocks * kULogicBlockLimbs * GMP_NUMB_BITS);
+	for (int plane = kValue; plane <= kSpecial; ++plane) {
+		fill(getPlane(Plane(plane)), getPlane(Plane(plane)) + planes_.getStride(),
+				Spread(code >> plane));
+	}
+	MaskToLength();
+}
+
+/**
+ * @brief Creates a StdULogicVector from a VHDL bit string literal.
+ * @param _value The std_ulogic characters, the most significant bit first
+ *   (e.g., "01XZ"). Invalid characters are treated as @c X.
+ */
+StdULogicVector::StdULogicVector(string_view _value) :
+		StdULogicVector(static_cast<int>(_value.size()), '0')
+{
+	for (int i = 0; i < length_; ++i) {
+		setBit(i, _value[length_ - 1 - i]);
+	}
+}
+
+/**
+ * @brief Creates a StdULogicVector holding the (strong) bits of a
+ *   StdLogicVector.
+ * @param _value The StdLogicVector to be converted. Bits beyond its length
+ *   are ignored.
+ */
+StdULogicVector::StdULogicVector(const StdLogicVector & _value) :
+		StdULogicVector(_value.getLength(), '0')
+{
+	mp_limb_t * value = getPlane(kValue);
+	mp_size_t size = min<mp_size_t>(mpz_size(_value.getValue()),
+			planes_.getStride());
+
+	if ( size > 0 ) {
+		mpn_copyi(value, mpz_limbs_read(_value.getValue()), size);
+	}
+	MaskToLength();
+}
+
+
+// ****************************************************************************
+// Getter/Setter functions
+// ****************************************************************************
+/**
+ * @brief Returns the length of the StdULogicVector in bits.
+ */
+int StdULogicVector::getLength() const {
+	return length_;
+}
+
+/**
+ * @brief Returns the value of a single bit.
+ * @param _index The 0-based index of the bit.
+ * @return The std_ulogic character of the bit (@c 0 for bits beyond the
+ *   length).
+ */
+char StdULogicVector::getBit(int _index) const {
+	int code = 0;
+
+	if ( _index < 0 || _index >= length_ ) {
+		return '0';
+	}
+	for (int plane = kValue; plane <= kSpecial; ++plane) {
+		code |= ((getPlane(Plane(plane))[_index / GMP_NUMB_BITS] >>
+				(_index % GMP_NUMB_BITS)) & 1) << plane;
+	}
+	return kCharacters[code];
+}
+
+/**
+ * @brief Assigns the value of a single bit.
+ * @param _index The 0-based index of the bit (ignored if out of range).
+ * @param _value The std_ulogic character of the bit. Invalid characters are
+ *   treated as @c X.
+ */
+void StdULogicVector::setBit(int _index, char _value) {
+	int code = CodeOf(_value);
+	mp_limb_t mask;
+
+	if ( _index < 0 || _index >= length_ ) {
+		return;
+	}
+	mask = static_cast<mp_limb_t>(1) << (_index % GMP_NUMB_BITS);
+	for (int plane = kValue; plane <= kSpecial; ++plane) {
+		mp_limb_t & limb = getPlane(Plane(plane))[_index / GMP_NUMB_BITS];
+
+		limb = (limb & ~mask) | (Spread(code >> plane) & mask);
+	}
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+/**
+ * @brief Determines whether any bit is unknown, analogous to the VHDL
+ *   function @c Is_X.
+ * @return True if any bit is @c U, @c X, @c Z, @c W or @c -.
+ */
+bool StdULogicVector::IsX() const {
+	const mp_limb_t * unknown = getPlane(kUnknown);
+
+	for (mp_size_t i = 0; i < planes_.getStride(); ++i) {
+		if ( unknown[i] != 0 ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Converts the StdULogicVector into a VHDL bit string literal.
+ * @return The std_ulogic characters, the most significant bit first.
+ */
+string StdULogicVector::ToString() const {
+	string result(length_, '0');
+
+	for (int i = 0; i < length_; ++i) {
+		result[length_ - 1 - i] = getBit(i);
+	}
+	return result;
+}
+
+/**
+ * @brief Converts the StdULogicVector into a StdLogicVector, analogous to the
+ *   VHDL function @c To_bitvector (i.e., @c 1 and @c H become 1, while all
+ *   other values become 0).
+ * @return A StdLogicVector of the same length.
+ */
+StdLogicVector StdULogicVector::ToStdLogicVector() const {
+	StdLogicVector result(length_);
+	mp_size_t size = StdLogicVector::LimbsForWidth(length_);
+	mp_limb_t * limbs = result.ModifyLimbs(size);
+	const mp_limb_t * value   = getPlane(kValue);
+	const mp_limb_t * unknown = getPlane(kUnknown);
+
+	for (mp_size_t i = 0; i < size; ++i) {
+		limbs[i] = value[i] & ~unknown[i];
+	}
+	result.FinishLimbs(size);
+
+	return result;
+}
+
+
+// ****************************************************************************
+// Operator overloadings
+// ****************************************************************************
+/**
+ * @brief Equality operator. Returns true if both the length and all bits of
+ *   the two vectors are identical.
+ */
+bool StdULogicVector::operator==(const StdULogicVector & _input) const {
+	mp_size_t size = 4 * planes_.getStride();
+
+	if ( length_ != _input.length_ ) {
+		return false;
+	}
+	return size == 0 || mpn_cmp(planes_.getLimbs(), _input.planes_.getLimbs(),
+			size) == 0;
+}
+
+/**
+ * @brief Inequality operator.
+ */
+bool StdULogicVector::operator!=(const StdULogicVector & _input) const {
+	return !(*this == _input);
+}
+
+/**
+ * @brief Provide a nice stream output showing the bits of the vector and also
+ *   its length.
+ */
+ostream & operator<<(ostream & _os, const StdULogicVector & _vec)
+{
+	return _os << _vec.ToString() << "(" << _vec.getLength() << "bits)";
+}
+
+
+// ****************************************************************************
+// Logical operations
+// ****************************************************************************
+/**
+ * @brief Logical AND operation (IEEE 1164 @c and table). A @c 0 or @c L in
+ *   either operand yields @c 0, otherwise any @c U yields @c U, any other
+ *   unknown value yields @c X, and two @c 1 or @c H yield @c 1.
+ * @param _operand The StdULogicVector to perform the AND operation with.
+ * @return This StdULogicVector.
+ */
+StdULogicVector & StdULogicVector::And(const StdULogicVector & _operand) {
+	if ( _operand.length_ == length_ && length_ > 0 ) {
+		ActiveULogicKernels().And(planes_.limbs_, _operand.planes_.limbs_,
+				planes_.getStride());
+	}
+	return *this;
+}
+
+/**
+ * @brief Logical OR operation (IEEE 1164 @c or table). A @c 1 or @c H in
+ *   either operand yields @c 1, otherwise any @c U yields @c U, any other
+ *   unknown value yields @c X, and two @c 0 or @c L yield @c 0.
+ * @param _operand The StdULogicVector to perform the OR operation with.
+ * @return This StdULogicVector.
+ */
+StdULogicVector & StdULogicVector::Or(const StdULogicVector & _operand) {
+	if ( _operand.length_ == length_ && length_ > 0 ) {
+		ActiveULogicKernels().Or(planes_.limbs_, _operand.planes_.limbs_,
+				planes_.getStride());
+	}
+	return *this;
+}
+
+/**
+ * @brief Logical XOR operation (IEEE 1164 @c xor table). Any @c U yields
+ *   @c U, any other unknown value yields @c X, and known values (including
+ *   @c L and @c H) yield their strong XOR.
+ * @param _operand The StdULogicVector to perform the XOR operation with.
+ * @return This StdULogicVector.
+ */
+StdULogicVector & StdULogicVector::Xor(const StdULogicVector & _operand) {
+	if ( _operand.length_ == length_ && length_ > 0 ) {
+		ActiveULogicKernels().Xor(planes_.limbs_, _operand.planes_.limbs_,
+				planes_.getStride());
+	}
+	return *this;
+}
+
+/**
+ * @brief Logical NOT operation (IEEE 1164 @c not table). @c U remains @c U,
+ *   any other unknown value becomes @c X, and known values (including @c L
+ *   and @c H) are inverted into strong ones.
+ * @return This StdULogicVector.
+ */
+StdULogicVector & StdULogicVector::Not() {
+	if ( length_ > 0 ) {
+		ActiveULogicKernels().Not(planes_.limbs_, planes_.getStride());
+		MaskToLength();
+	}
+	return *this;
+}
+
+/**
+ * @brief Resolves the vector with the value of another driver of the same
+ *   signal (IEEE 1164 @c resolved function).
+ *
+ * Any @c U yields @c U. Otherwise, the stronger of both drivers wins, where
+ * @c 0, @c 1, @c X and @c - are strong, @c L, @c H and @c W are weak and
+ * @c Z is the weakest value. Two drivers of the same strength yield their
+ * common value if both agree on a known value, or @c X (@c W for weak
+ * drivers) otherwise. A single strong @c - yields @c X.
+ *
+ * @param _driver The value of the other driver.
+ * @return This StdULogicVector.
+ */
+StdULogicVector & StdULogicVector::Resolve(const StdULogicVector & _driver) {
+	if ( _driver.length_ == length_ && length_ > 0 ) {
+		ActiveULogicKernels().Resolve(planes_.limbs_, _driver.planes_.limbs_,
+				planes_.getStride());
+	}
+	return *this;
+}
+
+
+// ****************************************************************************
+// Storage functions
+// ****************************************************************************
+/**
+ * @brief Returns the limbs of a single plane.
+ */
+mp_limb_t * StdULogicVector::getPlane(Plane _plane) {
+	return planes_.limbs_ + _plane * planes_.getStride();
+}
+
+/**
+ * @copydoc getPlane(Plane)
+ */
+const mp_limb_t * StdULogicVector::getPlane(Plane _plane) const {
+	return planes_.getLimbs() + _plane * planes_.getStride();
+}
+
+/**
+ * @brief Sets all bits beyond the length of the vector to @c 0 (in all
+ *   planes).
+ */
+void StdULogicVector::MaskToLength() {
+	mp_size_t used = StdLogicVector::LimbsForWidth(length_);
+
+	for (int plane = kValue; plane <= kSpecial; ++plane) {
+		mp_limb_t * limbs = getPlane(Plane(plane));
+
+		if ( length_ % GMP_NUMB_BITS != 0 ) {
+			limbs[used - 1] &=
+					(static_cast<mp_limb_t>(1) << (length_ % GMP_NUMB_BITS)) - 1;
+		}
+		fill(limbs + used, limbs + planes_.getStride(), 0);
+	}
+}